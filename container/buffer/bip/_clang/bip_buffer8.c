@@ -0,0 +1,260 @@
+/**
+ * @file	bip_buffer8.c
+ * @brief	bip buffer8
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include "allocator.h"
+
+#include "bip_buffer8.h"
+#include "lib_barrier.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	BipBuffer8
+ * @brief	BipBuffer8 struct (ring of contiguous regions)
+ * @note	Reserve always hands out a contiguous region. When the end of the
+ *			storage is too short, the region starts over at the beginning and
+ *			the skipped tail is excluded by a watermark. Read likewise always
+ *			returns a contiguous region, so a frame can be parsed in place.
+ * @note	Single-producer/single-consumer safe: reserve/commit and
+ *			read/release may be called from different contexts (e.g. ISR and
+ *			main loop) without masking interrupts.
+ */
+struct BipBuffer8 {
+	size_t sizeMax;
+	size_t write;			/*!< written by the producer only */
+	size_t watermark;		/*!< written by the producer only (end of data before a wrap) */
+	size_t reserveStart;	/*!< producer private */
+	size_t reserveSize;		/*!< producer private */
+	size_t read;			/*!< written by the consumer only */
+	uint8_t* elements;
+};
+
+/**
+ * @brief	Get the size of BipBuffer8
+ * @return	the size of BipBuffer8
+ */
+size_t BipBuffer8_sizeOf(void)
+{
+	return sizeof(BipBuffer8);
+}
+
+/**
+ * @brief	Create
+ * @param	size_max		the maximum number of elements
+ * @return	instance
+ */
+BipBuffer8* BipBuffer8_create(const size_t size_max)
+{
+	BipBuffer8* const instance = Allocator_allocate(sizeof(BipBuffer8));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (BipBuffer8_ctor(instance, size_max)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			BipBuffer8*
+ * @return	BipBuffer8*
+ */
+BipBuffer8* BipBuffer8_destroy(BipBuffer8* const self)
+{
+	if (!self) { return NULL; }
+
+	BipBuffer8_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			BipBuffer8*
+ * @param	size_max		the maximum number of elements
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int BipBuffer8_ctor(BipBuffer8* const self, const size_t size_max)
+{
+	if (size_max == 0) { return 1; }
+
+	self->sizeMax = size_max;
+	self->elements = Allocator_allocate(sizeof(uint8_t) * size_max);
+	if (!self->elements) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+
+	BipBuffer8_clear(self);
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			BipBuffer8*
+ * @return	none
+ */
+void BipBuffer8_dtor(BipBuffer8* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->elements);
+}
+
+/**
+ * @brief	Removes all elements
+ * @param	self			BipBuffer8*
+ * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
+ */
+void BipBuffer8_clear(BipBuffer8* const self)
+{
+	self->write = 0;
+	self->watermark = 0;
+	self->reserveStart = 0;
+	self->reserveSize = 0;
+	self->read = 0;
+	lib_barrier_release();
+}
+
+/**
+ * @brief	Reserves contiguous elements to write (producer)
+ * @param	self			BipBuffer8*
+ * @param	count			number of elements
+ * @return	pointer to the reserved elements (NULL: no contiguous space)
+ * @note	Fill them and call BipBuffer8_commit(). A new reserve replaces the last one.
+ */
+uint8_t* BipBuffer8_reserve(BipBuffer8* const self, const size_t count)
+{
+	const size_t write = self->write;
+	const size_t read = self->read;
+	lib_barrier_acquire();
+
+	size_t start;
+	if (write >= read) {
+		if ((self->sizeMax - write) >= count) {
+			start = write;
+		} else if (read > count) {
+			start = 0;	/* wrap, keeping write != read */
+		} else {
+			return NULL;
+		}
+	} else {
+		if ((read - write) > count) {
+			start = write;
+		} else {
+			return NULL;
+		}
+	}
+
+	self->reserveStart = start;
+	self->reserveSize = count;
+	return &self->elements[start];
+}
+
+/**
+ * @brief	Makes the reserved elements readable (producer)
+ * @param	self			BipBuffer8*
+ * @param	count			number of elements written (<= the reserved count)
+ * @return	none
+ */
+void BipBuffer8_commit(BipBuffer8* const self, const size_t count)
+{
+	const size_t used = (count < self->reserveSize) ? count : self->reserveSize;
+	self->reserveSize = 0;
+	if (used == 0) { return; }
+
+	const size_t write = self->write;
+	const size_t start = self->reserveStart;
+
+	if (start < write) { self->watermark = write; }	/* wrapped: data before the wrap ends here */
+	lib_barrier_release();
+	self->write = start + used;
+}
+
+/**
+ * @brief	Returns the contiguous readable elements (consumer)
+ * @param	self			BipBuffer8*
+ * @param	count			pointer to the number of readable elements
+ * @return	a pointer to the next element
+ * @note	Call BipBuffer8_release() and then this again to get the data after a wrap.
+ */
+uint8_t* BipBuffer8_read(BipBuffer8* const self, size_t* const count)
+{
+	const size_t write = self->write;
+	lib_barrier_acquire();
+	size_t read = self->read;
+
+	if (write < read) {
+		const size_t watermark = self->watermark;
+		if (read == watermark) {
+			read = 0;
+			self->read = 0;
+			*count = write;
+		} else {
+			*count = watermark - read;
+		}
+	} else {
+		*count = write - read;
+	}
+
+	return &self->elements[read];
+}
+
+/**
+ * @brief	Removes elements read through BipBuffer8_read() (consumer)
+ * @param	self			BipBuffer8*
+ * @param	count			number of elements (<= the count returned by BipBuffer8_read())
+ * @return	none
+ */
+void BipBuffer8_release(BipBuffer8* const self, const size_t count)
+{
+	const size_t read = self->read;
+
+	lib_barrier_release();
+	self->read = read + count;
+}
+
+/**
+ * @brief	Is empty
+ * @param	self			BipBuffer8*
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+bool BipBuffer8_empty(const BipBuffer8* const self)
+{
+	const size_t write = self->write;
+	lib_barrier_acquire();
+	return (write == self->read) ? true : false;
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @param	self			BipBuffer8*
+ * @return	the maximum number of elements
+ */
+size_t BipBuffer8_maxSize(const BipBuffer8* const self)
+{
+	return self->sizeMax;
+}
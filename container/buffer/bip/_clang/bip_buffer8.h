@@ -0,0 +1,46 @@
+/**
+ * @file	bip_buffer8.h
+ * @brief	bip buffer8
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_BIP_BUFFER8_H_INCLUDED_
+#define SDPSES_CONTAINER_BIP_BUFFER8_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct BipBuffer8;
+typedef struct BipBuffer8 BipBuffer8;
+
+size_t BipBuffer8_sizeOf(void);
+
+BipBuffer8* BipBuffer8_create(size_t size_max);
+BipBuffer8* BipBuffer8_destroy(BipBuffer8* self);
+
+int BipBuffer8_ctor(BipBuffer8* self, size_t size_max);
+void BipBuffer8_dtor(BipBuffer8* self);
+
+void BipBuffer8_clear(BipBuffer8* self);
+
+uint8_t* BipBuffer8_reserve(BipBuffer8* self, size_t count);
+void BipBuffer8_commit(BipBuffer8* self, size_t count);
+
+uint8_t* BipBuffer8_read(BipBuffer8* self, size_t* count);
+void BipBuffer8_release(BipBuffer8* self, size_t count);
+
+bool BipBuffer8_empty(const BipBuffer8* self);
+size_t BipBuffer8_maxSize(const BipBuffer8* self);
+
+#endif /* SDPSES_CONTAINER_BIP_BUFFER8_H_INCLUDED_ */
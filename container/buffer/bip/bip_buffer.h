@@ -0,0 +1,78 @@
+/**
+ * @file	bip_buffer.h
+ * @brief	bip buffer
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_BIP_BUFFER_H_INCLUDED_
+#define SDPSES_CONTAINER_BIP_BUFFER_H_INCLUDED_
+
+#include <cstddef>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @class	BipBuffer
+ * @brief	Bip Buffer class (ring of contiguous regions)
+ * @note	Don't inherit from this class.
+ * @note	reserve() always hands out a contiguous region. When the end of the
+ *			storage is too short, the region starts over at the beginning and
+ *			the skipped tail is excluded by a watermark. read() likewise always
+ *			returns a contiguous region, so a frame can be parsed in place.
+ * @note	Single-producer/single-consumer safe: reserve()/commit() and
+ *			read()/release() may be called from different contexts (e.g. ISR
+ *			and main loop) without masking interrupts.
+ * @note	T should be trivially copyable (e.g. uint8_t).
+ */
+template <typename T>
+class BipBuffer {
+
+public:
+	explicit BipBuffer(std::size_t size_max);
+	~BipBuffer();
+
+	void clear();
+
+	/* producer */
+	T* reserve(std::size_t count);
+	void commit(std::size_t count);
+
+	/* consumer */
+	T* read(std::size_t* count);
+	void release(std::size_t count);
+
+	bool empty() const;
+	std::size_t maxSize() const;
+
+private:
+	BipBuffer(const BipBuffer&);
+	BipBuffer& operator=(const BipBuffer&);
+
+	const std::size_t kSIZE_MAX;
+	std::size_t write_;			/*!< written by the producer only */
+	std::size_t watermark_;		/*!< written by the producer only (end of data before a wrap) */
+	std::size_t reserveStart_;	/*!< producer private */
+	std::size_t reserveSize_;	/*!< producer private */
+	std::size_t read_;			/*!< written by the consumer only */
+	T* const elements_;
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "bip_buffer_inline.h"
+
+#endif /* SDPSES_CONTAINER_BIP_BUFFER_H_INCLUDED_ */
@@ -0,0 +1,204 @@
+/**
+ * @file	bip_buffer_inline.h
+ * @brief	bip buffer inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+#include "allocator.h"
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
+
+#include <new>
+
+#include "lib_barrier.h"
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @brief	Constructor
+ * @param	size_max		the maximum number of elements
+ */
+template <typename T>
+inline BipBuffer<T>::BipBuffer(const std::size_t size_max)
+	: kSIZE_MAX(size_max)
+	, write_(0)
+	, watermark_(0)
+	, reserveStart_(0)
+	, reserveSize_(0)
+	, read_(0)
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	, elements_(static_cast<T*>(Allocator_allocate(sizeof(T) * size_max)))
+#else
+	, elements_(static_cast<T*>(::operator new(sizeof(T) * size_max)))
+#endif
+{
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename T>
+inline BipBuffer<T>::~BipBuffer()
+{
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	Allocator_deallocate(elements_);
+#else
+	::operator delete(elements_);
+#endif
+}
+
+/**
+ * @brief	Removes all elements
+ * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
+ */
+template <typename T>
+inline void BipBuffer<T>::clear()
+{
+	write_ = 0;
+	watermark_ = 0;
+	reserveStart_ = 0;
+	reserveSize_ = 0;
+	read_ = 0;
+	lib_barrier_release();
+}
+
+/**
+ * @brief	Reserves contiguous elements to write (producer)
+ * @param	count			number of elements
+ * @return	pointer to the reserved elements (NULL: no contiguous space)
+ * @note	Fill them and call commit(). A new reserve() replaces the last one.
+ */
+template <typename T>
+inline T* BipBuffer<T>::reserve(const std::size_t count)
+{
+	const std::size_t write = write_;
+	const std::size_t read = read_;
+	lib_barrier_acquire();
+
+	std::size_t start;
+	if (write >= read) {
+		if ((kSIZE_MAX - write) >= count) {
+			start = write;
+		} else if (read > count) {
+			start = 0;	/* wrap, keeping write != read */
+		} else {
+			return 0;
+		}
+	} else {
+		if ((read - write) > count) {
+			start = write;
+		} else {
+			return 0;
+		}
+	}
+
+	reserveStart_ = start;
+	reserveSize_ = count;
+	return &elements_[start];
+}
+
+/**
+ * @brief	Makes the reserved elements readable (producer)
+ * @param	count			number of elements written (<= the reserved count)
+ * @return	none
+ */
+template <typename T>
+inline void BipBuffer<T>::commit(const std::size_t count)
+{
+	const std::size_t used = (count < reserveSize_) ? count : reserveSize_;
+	reserveSize_ = 0;
+	if (used == 0) { return; }
+
+	const std::size_t write = write_;
+	const std::size_t start = reserveStart_;
+
+	if (start < write) { watermark_ = write; }	/* wrapped: data before the wrap ends here */
+	lib_barrier_release();
+	write_ = start + used;
+}
+
+/**
+ * @brief	Returns the contiguous readable elements (consumer)
+ * @param	count			pointer to the number of readable elements
+ * @return	a pointer to the next element
+ * @note	Call release() and then this again to get the data after a wrap.
+ */
+template <typename T>
+inline T* BipBuffer<T>::read(std::size_t* const count)
+{
+	const std::size_t write = write_;
+	lib_barrier_acquire();
+	std::size_t read = read_;
+
+	if (write < read) {
+		const std::size_t watermark = watermark_;
+		if (read == watermark) {
+			read = 0;
+			read_ = 0;
+			*count = write;
+		} else {
+			*count = watermark - read;
+		}
+	} else {
+		*count = write - read;
+	}
+
+	return &elements_[read];
+}
+
+/**
+ * @brief	Removes elements read through read() (consumer)
+ * @param	count			number of elements (<= the count returned by read())
+ * @return	none
+ */
+template <typename T>
+inline void BipBuffer<T>::release(const std::size_t count)
+{
+	const std::size_t read = read_;
+
+	lib_barrier_release();
+	read_ = read + count;
+}
+
+/**
+ * @brief	Is empty
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+template <typename T>
+inline bool BipBuffer<T>::empty() const
+{
+	const std::size_t write = write_;
+	lib_barrier_acquire();
+	return (write == read_) ? true : false;
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @return	the maximum number of elements
+ */
+template <typename T>
+inline std::size_t BipBuffer<T>::maxSize() const
+{
+	return kSIZE_MAX;
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
@@ -0,0 +1,79 @@
+/**
+ * @file	triple_buffer.h
+ * @brief	triple buffer
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_TRIPLE_BUFFER_H_INCLUDED_
+#define SDPSES_CONTAINER_TRIPLE_BUFFER_H_INCLUDED_
+
+#include <cstddef>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @class	TripleBuffer
+ * @brief	Triple Buffer class (latest-value state from an ISR)
+ * @note	Don't inherit from this class.
+ * @note	The writer fills one buffer while the reader holds another, and the
+ *			third (the back buffer) keeps the latest complete value. Each side
+ *			swaps its own buffer with the back buffer in one atomic exchange,
+ *			so neither side can pick the buffer the other holds and the reader
+ *			never sees a torn value.
+ * @note	One writer and one reader (e.g. an ISR and the main loop). Neither
+ *			side waits. On Nios II and MicroBlaze the exchange masks interrupts
+ *			for a few instructions.
+ */
+template <typename T>
+class TripleBuffer {
+
+public:
+	TripleBuffer();
+	explicit TripleBuffer(const T& initial_value);
+	~TripleBuffer();
+
+	/* writer */
+	T& writeBuffer();
+	void publish();
+	void write(const T& value);
+
+	/* reader */
+	const T& read();
+	bool updated() const;
+
+private:
+	TripleBuffer(const TripleBuffer&);
+	TripleBuffer& operator=(const TripleBuffer&);
+
+	std::size_t loadBack() const;
+	std::size_t exchangeBack(std::size_t back);
+
+	static const std::size_t kBUFFER_NUM = 3;
+	static const std::size_t kINDEX_MASK = 0x3;
+	static const std::size_t kFRESH = 0x4;	/*!< the back buffer is published but not read yet */
+
+	std::size_t writing_;	/*!< accessed by the writer only */
+	volatile std::size_t back_;	/*!< index | kFRESH, swapped by exchangeBack() only */
+	std::size_t reading_;	/*!< accessed by the reader only */
+	T buffers_[kBUFFER_NUM];
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "triple_buffer_inline.h"
+
+#endif /* SDPSES_CONTAINER_TRIPLE_BUFFER_H_INCLUDED_ */
@@ -0,0 +1,169 @@
+/**
+ * @file	triple_buffer_inline.h
+ * @brief	triple buffer inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#include "lib_barrier.h"
+#include "lib_critical_section.h"
+
+namespace sdpses {
+
+namespace container {
+
+template <typename T>
+const std::size_t TripleBuffer<T>::kBUFFER_NUM;
+
+template <typename T>
+const std::size_t TripleBuffer<T>::kINDEX_MASK;
+
+template <typename T>
+const std::size_t TripleBuffer<T>::kFRESH;
+
+/**
+ * @brief	Constructor
+ */
+template <typename T>
+inline TripleBuffer<T>::TripleBuffer()
+	: writing_(2)
+	, back_(1)
+	, reading_(0)
+	, buffers_()
+{
+}
+
+/**
+ * @brief	Constructor
+ * @param	initial_value	value read until the first publish()
+ */
+template <typename T>
+inline TripleBuffer<T>::TripleBuffer(const T& initial_value)
+	: writing_(2)
+	, back_(1)
+	, reading_(0)
+{
+	for (std::size_t i = 0; i < kBUFFER_NUM; i++) {
+		buffers_[i] = initial_value;
+	}
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename T>
+inline TripleBuffer<T>::~TripleBuffer()
+{
+}
+
+/**
+ * @brief	Returns the buffer to fill (writer)
+ * @return	a reference to the buffer
+ * @note	Fill it and call publish(). Its previous contents are stale.
+ */
+template <typename T>
+inline T& TripleBuffer<T>::writeBuffer()
+{
+	return buffers_[writing_];
+}
+
+/**
+ * @brief	Publishes the buffer returned by writeBuffer() (writer)
+ * @return	none
+ * @note	The writer continues with the previous back buffer.
+ */
+template <typename T>
+inline void TripleBuffer<T>::publish()
+{
+	writing_ = exchangeBack(writing_ | kFRESH) & kINDEX_MASK;
+}
+
+/**
+ * @brief	Writes and publishes the value (writer)
+ * @param	value			value
+ * @return	none
+ */
+template <typename T>
+inline void TripleBuffer<T>::write(const T& value)
+{
+	buffers_[writing_] = value;
+	publish();
+}
+
+/**
+ * @brief	Returns the latest published value (reader)
+ * @return	a reference to the value, valid until the next read()
+ */
+template <typename T>
+inline const T& TripleBuffer<T>::read()
+{
+	if (loadBack() & kFRESH) {
+		reading_ = exchangeBack(reading_) & kINDEX_MASK;
+	}
+
+	return buffers_[reading_];
+}
+
+/**
+ * @brief	Has a value been published since the last read() (reader)
+ * @retval	true			updated
+ * @retval	false			not updated
+ */
+template <typename T>
+inline bool TripleBuffer<T>::updated() const
+{
+	return (loadBack() & kFRESH) ? true : false;
+}
+
+/**
+ * @brief	Loads the back buffer
+ * @return	the back buffer (index | kFRESH)
+ */
+template <typename T>
+inline std::size_t TripleBuffer<T>::loadBack() const
+{
+#if defined(__NIOS2__) || defined(__MICROBLAZE__)
+	return back_;
+#else
+	return __atomic_load_n(&back_, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * @brief	Swaps the back buffer
+ * @param	back			the new back buffer (index | kFRESH)
+ * @return	the previous back buffer (index | kFRESH)
+ * @note	Orders the accesses to the buffers before and after the swap.
+ */
+template <typename T>
+inline std::size_t TripleBuffer<T>::exchangeBack(const std::size_t back)
+{
+#if defined(__NIOS2__) || defined(__MICROBLAZE__)
+	/* no atomic exchange instruction: single core, so masking interrupts is enough */
+	const lib_critical_section_t context = lib_critical_section_enter();
+	lib_barrier_release();
+	const std::size_t previous = back_;
+	back_ = back;
+	lib_barrier_acquire();
+	lib_critical_section_exit(context);
+
+	return previous;
+#else
+	return __atomic_exchange_n(&back_, back, __ATOMIC_ACQ_REL);
+#endif
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
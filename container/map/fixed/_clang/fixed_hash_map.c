@@ -0,0 +1,328 @@
+/**
+ * @file	fixed_hash_map.c
+ * @brief	fixed-size hash map
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "allocator.h"
+
+#include "fixed_hash_map.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	FixedHashMap
+ * @brief	FixedHashMap struct (open addressing, Robin Hood probing)
+ * @note	The table is allocated at construction and never grows.
+ * @note	Lookups probe at most maxProbe + 1 slots. The maximum probe length
+ *			only grows until FixedHashMap_clear(), so the worst case of a lookup
+ *			in an ISR can be checked once the table is populated.
+ * @note	Not interrupt safe: don't modify the map while an ISR looks it up.
+ */
+struct FixedHashMap {
+	size_t sizeMax;		/*!< power of two */
+	size_t valueSize;
+	size_t size;
+	size_t maxProbe;
+	uint32_t* distance;	/*!< 0: empty, otherwise probe length + 1 */
+	uint32_t* keys;
+	uint8_t* values;
+};
+
+static inline size_t home(const FixedHashMap* const self, const uint32_t key) {
+	const uint32_t hash = key * 2654435769UL;
+	return ((hash ^ (hash >> 16)) & (self->sizeMax - 1));
+}
+
+static inline size_t next_slot(const FixedHashMap* const self, const size_t index) {
+	return ((index + 1) & (self->sizeMax - 1));
+}
+
+static inline void* value_at(const FixedHashMap* const self, const size_t index) {
+	return &self->values[index * self->valueSize];
+}
+
+static inline size_t max_size(const size_t a, const size_t b) {
+	return (a < b) ? b : a;
+}
+
+static size_t lookup(const FixedHashMap* const self, const uint32_t key)
+{
+	size_t index = home(self, key);
+
+	for (uint32_t distance = 1; distance <= (self->maxProbe + 1); distance++) {
+		if (self->distance[index] < distance) { break; }
+		if ((self->distance[index] == distance) && (self->keys[index] == key)) { return index; }
+		index = next_slot(self, index);
+	}
+
+	return self->sizeMax;	/* not found */
+}
+
+/**
+ * @brief	Get the size of FixedHashMap
+ * @return	the size of FixedHashMap
+ */
+size_t FixedHashMap_sizeOf(void)
+{
+	return sizeof(FixedHashMap);
+}
+
+/**
+ * @brief	Create
+ * @param	size_max		the maximum number of entries (power of two)
+ * @param	value_size		value size [byte]
+ * @return	instance
+ */
+FixedHashMap* FixedHashMap_create(const size_t size_max, const size_t value_size)
+{
+	FixedHashMap* const instance = Allocator_allocate(sizeof(FixedHashMap));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (FixedHashMap_ctor(instance, size_max, value_size)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			FixedHashMap*
+ * @return	FixedHashMap*
+ */
+FixedHashMap* FixedHashMap_destroy(FixedHashMap* const self)
+{
+	if (!self) { return NULL; }
+
+	FixedHashMap_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			FixedHashMap*
+ * @param	size_max		the maximum number of entries (power of two)
+ * @param	value_size		value size [byte]
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int FixedHashMap_ctor(FixedHashMap* const self, const size_t size_max, const size_t value_size)
+{
+	if ((size_max == 0) || (size_max & (size_max - 1))) {
+		DEBUG_PRINTF_("size_max must be a power of two\r\n");
+		return 1;
+	}
+	if (value_size == 0) {
+		DEBUG_PRINTF_("value_size must not be zero\r\n");
+		return 1;
+	}
+
+	self->sizeMax = size_max;
+	self->valueSize = value_size;
+
+	/* values first for their alignment, then distances and keys from a uint32_t boundary */
+	const size_t valuesSize = ((value_size * size_max) + (sizeof(uint32_t) - 1)) & ~(sizeof(uint32_t) - 1);
+	self->values = Allocator_allocate(valuesSize + ((sizeof(uint32_t) * 2) * size_max));
+	if (!self->values) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+	self->distance = (uint32_t*)&self->values[valuesSize];
+	self->keys = &self->distance[size_max];
+
+	FixedHashMap_clear(self);
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			FixedHashMap*
+ * @return	none
+ */
+void FixedHashMap_dtor(FixedHashMap* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->values);
+}
+
+/**
+ * @brief	Removes all entries
+ * @param	self			FixedHashMap*
+ * @return	none
+ */
+void FixedHashMap_clear(FixedHashMap* const self)
+{
+	memset(self->distance, 0, (sizeof(uint32_t) * self->sizeMax));
+	self->size = 0;
+	self->maxProbe = 0;
+}
+
+/**
+ * @brief	Inserts a entry, or assigns the value if the key exists
+ * @param	self			FixedHashMap*
+ * @param	key				key
+ * @param	value			pointer to the value (valueSize bytes)
+ * @retval	true			success
+ * @retval	false			full
+ */
+bool FixedHashMap_insert(FixedHashMap* const self, const uint32_t key, const void* const value)
+{
+	const size_t found = lookup(self, key);
+	if (found != self->sizeMax) {
+		memcpy(value_at(self, found), value, self->valueSize);
+		return true;
+	}
+	if (self->size >= self->sizeMax) { return false; }
+
+	/* Find the slot where the new entry settles, then shift the poorer run right. */
+	size_t index = home(self, key);
+	uint32_t distance = 1;
+	while ((self->distance[index] != 0) && (self->distance[index] >= distance)) {
+		index = next_slot(self, index);
+		distance++;
+	}
+
+	size_t end = index;
+	while (self->distance[end] != 0) {
+		end = next_slot(self, end);
+	}
+	while (end != index) {
+		const size_t prev = (end + self->sizeMax - 1) & (self->sizeMax - 1);
+		self->distance[end] = self->distance[prev] + 1;
+		self->keys[end] = self->keys[prev];
+		memcpy(value_at(self, end), value_at(self, prev), self->valueSize);
+		self->maxProbe = max_size(self->maxProbe, (self->distance[end] - 1));
+		end = prev;
+	}
+
+	self->distance[index] = distance;
+	self->keys[index] = key;
+	memcpy(value_at(self, index), value, self->valueSize);
+	self->maxProbe = max_size(self->maxProbe, (distance - 1));
+	self->size++;
+
+	return true;
+}
+
+/**
+ * @brief	Removes the entry of the key
+ * @param	self			FixedHashMap*
+ * @param	key				key
+ * @retval	true			removed
+ * @retval	false			not found
+ */
+bool FixedHashMap_erase(FixedHashMap* const self, const uint32_t key)
+{
+	size_t index = lookup(self, key);
+	if (index == self->sizeMax) { return false; }
+
+	/* backward shift instead of tombstones */
+	for (;;) {
+		const size_t next = next_slot(self, index);
+		if (self->distance[next] <= 1) { break; }
+		self->distance[index] = self->distance[next] - 1;
+		self->keys[index] = self->keys[next];
+		memcpy(value_at(self, index), value_at(self, next), self->valueSize);
+		index = next;
+	}
+	self->distance[index] = 0;
+	self->size--;
+
+	return true;
+}
+
+/**
+ * @brief	Finds the value of the key
+ * @param	self			FixedHashMap*
+ * @param	key				key
+ * @return	pointer to the value (NULL: not found)
+ */
+void* FixedHashMap_find(const FixedHashMap* const self, const uint32_t key)
+{
+	const size_t index = lookup(self, key);
+	return (index != self->sizeMax) ? value_at(self, index) : NULL;
+}
+
+/**
+ * @brief	Is the key in the map
+ * @param	self			FixedHashMap*
+ * @param	key				key
+ * @retval	true			found
+ * @retval	false			not found
+ */
+bool FixedHashMap_contains(const FixedHashMap* const self, const uint32_t key)
+{
+	return (lookup(self, key) != self->sizeMax) ? true : false;
+}
+
+/**
+ * @brief	Is empty
+ * @param	self			FixedHashMap*
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+bool FixedHashMap_empty(const FixedHashMap* const self)
+{
+	return (self->size) ? false : true;
+}
+
+/**
+ * @brief	Is full
+ * @param	self			FixedHashMap*
+ * @retval	true			full
+ * @retval	false			not full
+ */
+bool FixedHashMap_full(const FixedHashMap* const self)
+{
+	return (self->size < self->sizeMax) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of entries
+ * @param	self			FixedHashMap*
+ * @return	the number of entries
+ */
+size_t FixedHashMap_size(const FixedHashMap* const self)
+{
+	return self->size;
+}
+
+/**
+ * @brief	Returns the maximum number of entries
+ * @param	self			FixedHashMap*
+ * @return	the maximum number of entries
+ */
+size_t FixedHashMap_maxSize(const FixedHashMap* const self)
+{
+	return self->sizeMax;
+}
+
+/**
+ * @brief	Returns the longest probe length since FixedHashMap_clear()
+ * @param	self			FixedHashMap*
+ * @return	the longest probe length (a lookup probes one more slot at most)
+ */
+size_t FixedHashMap_maxProbeLength(const FixedHashMap* const self)
+{
+	return self->maxProbe;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file	fixed_hash_map.h
+ * @brief	fixed-size hash map
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct FixedHashMap;
+typedef struct FixedHashMap FixedHashMap;
+
+size_t FixedHashMap_sizeOf(void);
+
+FixedHashMap* FixedHashMap_create(size_t size_max, size_t value_size);
+FixedHashMap* FixedHashMap_destroy(FixedHashMap* self);
+
+int FixedHashMap_ctor(FixedHashMap* self, size_t size_max, size_t value_size);
+void FixedHashMap_dtor(FixedHashMap* self);
+
+void FixedHashMap_clear(FixedHashMap* self);
+bool FixedHashMap_insert(FixedHashMap* self, uint32_t key, const void* value);
+bool FixedHashMap_erase(FixedHashMap* self, uint32_t key);
+void* FixedHashMap_find(const FixedHashMap* self, uint32_t key);
+bool FixedHashMap_contains(const FixedHashMap* self, uint32_t key);
+
+bool FixedHashMap_empty(const FixedHashMap* self);
+bool FixedHashMap_full(const FixedHashMap* self);
+
+size_t FixedHashMap_size(const FixedHashMap* self);
+size_t FixedHashMap_maxSize(const FixedHashMap* self);
+size_t FixedHashMap_maxProbeLength(const FixedHashMap* self);
+
+#endif /* SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_ */
@@ -0,0 +1,97 @@
+/**
+ * @file	fixed_hash_map.h
+ * @brief	fixed-size hash map
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_
+
+#include <cstddef>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @struct	FixedHash
+ * @brief	Default hash of FixedHashMap (integral keys)
+ * @note	Fibonacci hashing: the upper bits are spread by the multiplication.
+ */
+template <typename K>
+struct FixedHash {
+	std::size_t operator()(const K& key) const {
+		const unsigned long hash = static_cast<unsigned long>(key) * 2654435769UL;
+		return static_cast<std::size_t>(hash ^ (hash >> 16));
+	}
+};
+
+/**
+ * @class	FixedHashMap
+ * @brief	Fixed-size Hash Map class (open addressing, Robin Hood probing)
+ * @note	Don't inherit from this class.
+ * @note	N entries are kept inline and nothing is allocated. N must be a
+ *			power of two. K and V must be default-constructible and assignable.
+ * @note	Lookups probe at most maxProbeLength() + 1 slots. The maximum probe
+ *			length only grows until clear(), so the worst case of a lookup in an
+ *			ISR can be checked once the table is populated.
+ * @note	Not interrupt safe: don't modify the map while an ISR looks it up.
+ */
+template <typename K, typename V, std::size_t N, typename Hash = FixedHash<K> >
+class FixedHashMap {
+
+public:
+	explicit FixedHashMap(const Hash& hash = Hash());
+	~FixedHashMap();
+
+	void clear();
+	bool insert(const K& key, const V& value);
+	bool erase(const K& key);
+	V* find(const K& key);
+	const V* find(const K& key) const;
+	bool contains(const K& key) const;
+
+	bool empty() const;
+	bool full() const;
+
+	std::size_t size() const;
+	std::size_t maxSize() const;
+	std::size_t maxProbeLength() const;
+
+private:
+	FixedHashMap(const FixedHashMap&);
+	FixedHashMap& operator=(const FixedHashMap&);
+
+	/*! @note Compile error unless N is a power of two. */
+	typedef char PowerOfTwoCheck[((N > 0) && ((N & (N - 1)) == 0)) ? 1 : -1];
+
+	std::size_t home(const K& key) const;
+	std::size_t lookup(const K& key) const;
+
+	static const std::size_t kNOT_FOUND = static_cast<std::size_t>(-1);
+
+	const Hash hash_;
+	std::size_t size_;
+	std::size_t maxProbe_;
+	std::size_t distance_[N];	/*!< 0: empty, otherwise probe length + 1 */
+	K keys_[N];
+	V values_[N];
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "fixed_hash_map_inline.h"
+
+#endif /* SDPSES_CONTAINER_FIXED_HASH_MAP_H_INCLUDED_ */
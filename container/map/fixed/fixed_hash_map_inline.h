@@ -0,0 +1,250 @@
+/**
+ * @file	fixed_hash_map_inline.h
+ * @brief	fixed-size hash map inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#include <algorithm>
+
+namespace sdpses {
+
+namespace container {
+
+template <typename K, typename V, std::size_t N, typename Hash>
+const std::size_t FixedHashMap<K, V, N, Hash>::kNOT_FOUND;
+
+/**
+ * @brief	Constructor
+ * @param	hash			hash function object
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline FixedHashMap<K, V, N, Hash>::FixedHashMap(const Hash& hash)
+	: hash_(hash)
+	, size_(0)
+	, maxProbe_(0)
+	, distance_()
+	, keys_()
+	, values_()
+{
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline FixedHashMap<K, V, N, Hash>::~FixedHashMap()
+{
+}
+
+/**
+ * @brief	Removes all entries
+ * @return	none
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline void FixedHashMap<K, V, N, Hash>::clear()
+{
+	std::fill(&distance_[0], &distance_[N], 0);
+	size_ = 0;
+	maxProbe_ = 0;
+}
+
+/**
+ * @brief	Inserts a entry, or assigns the value if the key exists
+ * @param	key				key
+ * @param	value			value
+ * @retval	true			success
+ * @retval	false			full
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline bool FixedHashMap<K, V, N, Hash>::insert(const K& key, const V& value)
+{
+	const std::size_t found = lookup(key);
+	if (found != kNOT_FOUND) {
+		values_[found] = value;
+		return true;
+	}
+	if (size_ >= N) { return false; }
+
+	K k = key;
+	V v = value;
+	std::size_t distance = 1;
+	std::size_t index = home(key);
+
+	for (;;) {
+		if (distance_[index] == 0) {
+			distance_[index] = distance;
+			keys_[index] = k;
+			values_[index] = v;
+			maxProbe_ = std::max(maxProbe_, (distance - 1));
+			size_++;
+			return true;
+		}
+
+		/* Robin Hood: the entry closer to its home gives way. */
+		if (distance_[index] < distance) {
+			std::swap(distance_[index], distance);
+			std::swap(keys_[index], k);
+			std::swap(values_[index], v);
+			maxProbe_ = std::max(maxProbe_, (distance_[index] - 1));
+		}
+
+		index = (index + 1) & (N - 1);
+		distance++;
+	}
+}
+
+/**
+ * @brief	Removes the entry of the key
+ * @param	key				key
+ * @retval	true			removed
+ * @retval	false			not found
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline bool FixedHashMap<K, V, N, Hash>::erase(const K& key)
+{
+	std::size_t index = lookup(key);
+	if (index == kNOT_FOUND) { return false; }
+
+	/* backward shift instead of tombstones */
+	for (;;) {
+		const std::size_t next = (index + 1) & (N - 1);
+		if (distance_[next] <= 1) { break; }
+		distance_[index] = distance_[next] - 1;
+		keys_[index] = keys_[next];
+		values_[index] = values_[next];
+		index = next;
+	}
+	distance_[index] = 0;
+	size_--;
+
+	return true;
+}
+
+/**
+ * @brief	Finds the value of the key
+ * @param	key				key
+ * @return	pointer to the value (NULL: not found)
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline V* FixedHashMap<K, V, N, Hash>::find(const K& key)
+{
+	const std::size_t index = lookup(key);
+	return (index != kNOT_FOUND) ? &values_[index] : 0;
+}
+
+template <typename K, typename V, std::size_t N, typename Hash>
+inline const V* FixedHashMap<K, V, N, Hash>::find(const K& key) const
+{
+	const std::size_t index = lookup(key);
+	return (index != kNOT_FOUND) ? &values_[index] : 0;
+}
+
+/**
+ * @brief	Is the key in the map
+ * @param	key				key
+ * @retval	true			found
+ * @retval	false			not found
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline bool FixedHashMap<K, V, N, Hash>::contains(const K& key) const
+{
+	return (lookup(key) != kNOT_FOUND) ? true : false;
+}
+
+/**
+ * @brief	Is empty
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline bool FixedHashMap<K, V, N, Hash>::empty() const
+{
+	return (size_) ? false : true;
+}
+
+/**
+ * @brief	Is full
+ * @retval	true			full
+ * @retval	false			not full
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline bool FixedHashMap<K, V, N, Hash>::full() const
+{
+	return (size_ < N) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of entries
+ * @return	the number of entries
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline std::size_t FixedHashMap<K, V, N, Hash>::size() const
+{
+	return size_;
+}
+
+/**
+ * @brief	Returns the maximum number of entries
+ * @return	the maximum number of entries
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline std::size_t FixedHashMap<K, V, N, Hash>::maxSize() const
+{
+	return N;
+}
+
+/**
+ * @brief	Returns the longest probe length since clear()
+ * @return	the longest probe length (a lookup probes one more slot at most)
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline std::size_t FixedHashMap<K, V, N, Hash>::maxProbeLength() const
+{
+	return maxProbe_;
+}
+
+/**
+ * @brief	Returns the home slot of the key
+ * @param	key				key
+ * @return	slot index
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline std::size_t FixedHashMap<K, V, N, Hash>::home(const K& key) const
+{
+	return (hash_(key) & (N - 1));
+}
+
+/**
+ * @brief	Returns the slot of the key
+ * @param	key				key
+ * @return	slot index (kNOT_FOUND: not found)
+ */
+template <typename K, typename V, std::size_t N, typename Hash>
+inline std::size_t FixedHashMap<K, V, N, Hash>::lookup(const K& key) const
+{
+	std::size_t index = home(key);
+
+	for (std::size_t distance = 1; distance <= (maxProbe_ + 1); distance++) {
+		if (distance_[index] < distance) { break; }
+		if ((distance_[index] == distance) && (keys_[index] == key)) { return index; }
+		index = (index + 1) & (N - 1);
+	}
+
+	return kNOT_FOUND;
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
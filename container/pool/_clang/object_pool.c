@@ -0,0 +1,227 @@
+/**
+ * @file	object_pool.c
+ * @brief	fixed-size object pool
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include "allocator.h"
+
+#include "object_pool.h"
+#include "lib_assert.h"
+#include "lib_critical_section.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	FreeSlot
+ * @brief	Link stored in a free slot
+ */
+struct FreeSlot {
+	struct FreeSlot* next;
+};
+
+/**
+ * @struct	ObjectPool
+ * @brief	ObjectPool struct
+ * @note	The slots are reserved at construction. Free slots are linked
+ *			through their own storage, so acquire and release are O(1).
+ * @note	With isrSafe, acquire and release mask interrupts for a few
+ *			instructions, so the pool may be shared with ISRs.
+ */
+struct ObjectPool {
+	size_t slotSize;
+	size_t slotCount;
+	size_t availableSize;
+	bool isrSafe;
+	struct FreeSlot* free;
+	uint8_t* slots;
+};
+
+enum { kSLOT_ALIGNMENT = sizeof(uint64_t) };	/*!< power-of-two */
+
+static inline size_t slot_size(const size_t object_size) {
+	const size_t size = (object_size < sizeof(struct FreeSlot)) ? sizeof(struct FreeSlot) : object_size;
+	return ((size + (kSLOT_ALIGNMENT - 1)) & ~(size_t)(kSLOT_ALIGNMENT - 1));
+}
+
+/**
+ * @brief	Get the size of ObjectPool
+ * @return	the size of ObjectPool
+ */
+size_t ObjectPool_sizeOf(void)
+{
+	return sizeof(ObjectPool);
+}
+
+/**
+ * @brief	Create
+ * @param	object_size		object size [byte]
+ * @param	object_count	the number of objects
+ * @param	isr_safe		mask interrupts in acquire and release
+ * @return	instance
+ */
+ObjectPool* ObjectPool_create(const size_t object_size, const size_t object_count, const bool isr_safe)
+{
+	ObjectPool* const instance = Allocator_allocate(sizeof(ObjectPool));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (ObjectPool_ctor(instance, object_size, object_count, isr_safe)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			ObjectPool*
+ * @return	ObjectPool*
+ */
+ObjectPool* ObjectPool_destroy(ObjectPool* const self)
+{
+	if (!self) { return NULL; }
+
+	ObjectPool_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			ObjectPool*
+ * @param	object_size		object size [byte]
+ * @param	object_count	the number of objects
+ * @param	isr_safe		mask interrupts in acquire and release
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int ObjectPool_ctor(ObjectPool* const self, const size_t object_size, const size_t object_count, const bool isr_safe)
+{
+	if ((object_size == 0) || (object_count == 0)) { return 1; }
+
+	self->slotSize = slot_size(object_size);
+	self->slotCount = object_count;
+	self->availableSize = object_count;
+	self->isrSafe = isr_safe;
+	self->slots = Allocator_allocate(self->slotSize * object_count);
+	if (!self->slots) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+
+	self->free = NULL;
+	for (size_t i = object_count; i > 0; i--) {
+		struct FreeSlot* const slot = (struct FreeSlot*)&self->slots[(i - 1) * self->slotSize];
+		slot->next = self->free;
+		self->free = slot;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			ObjectPool*
+ * @return	none
+ */
+void ObjectPool_dtor(ObjectPool* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->slots);
+}
+
+/**
+ * @brief	Acquires a object
+ * @param	self			ObjectPool*
+ * @return	pointer to the object (NULL: exhausted)
+ */
+void* ObjectPool_acquire(ObjectPool* const self)
+{
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+
+	struct FreeSlot* const slot = self->free;
+	if (slot) {
+		self->free = slot->next;
+		self->availableSize--;
+	}
+
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+
+	return slot;
+}
+
+/**
+ * @brief	Releases a object
+ * @param	self			ObjectPool*
+ * @param	object			pointer returned by ObjectPool_acquire() (NULL is ignored)
+ * @return	none
+ *
+ * @pre ObjectPool_owns(object)
+ */
+void ObjectPool_release(ObjectPool* const self, void* const object)
+{
+	if (!object) { return; }
+
+	ASSERT_(ObjectPool_owns(self, object));
+
+	struct FreeSlot* const slot = object;
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+
+	slot->next = self->free;
+	self->free = slot;
+	self->availableSize++;
+
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+}
+
+/**
+ * @brief	Is the pointer a object of this pool
+ * @param	self			ObjectPool*
+ * @param	object			pointer
+ * @retval	true			owned
+ * @retval	false			not owned
+ */
+bool ObjectPool_owns(const ObjectPool* const self, const void* const object)
+{
+	const uint8_t* const p = object;
+	const uint8_t* const first = self->slots;
+	const uint8_t* const last = &self->slots[self->slotSize * self->slotCount];
+
+	if ((p < first) || (p >= last)) { return false; }
+	return (((size_t)(p - first) % self->slotSize) == 0) ? true : false;
+}
+
+/**
+ * @brief	Returns the number of free objects
+ * @param	self			ObjectPool*
+ * @return	the number of free objects
+ */
+size_t ObjectPool_availableSize(const ObjectPool* const self)
+{
+	return self->availableSize;
+}
+
+/**
+ * @brief	Returns the number of objects
+ * @param	self			ObjectPool*
+ * @return	the number of objects
+ */
+size_t ObjectPool_maxSize(const ObjectPool* const self)
+{
+	return self->slotCount;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file	object_pool.h
+ * @brief	fixed-size object pool
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_
+#define SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ObjectPool;
+typedef struct ObjectPool ObjectPool;
+
+size_t ObjectPool_sizeOf(void);
+
+ObjectPool* ObjectPool_create(size_t object_size, size_t object_count, bool isr_safe);
+ObjectPool* ObjectPool_destroy(ObjectPool* self);
+
+int ObjectPool_ctor(ObjectPool* self, size_t object_size, size_t object_count, bool isr_safe);
+void ObjectPool_dtor(ObjectPool* self);
+
+void* ObjectPool_acquire(ObjectPool* self);
+void ObjectPool_release(ObjectPool* self, void* object);
+
+bool ObjectPool_owns(const ObjectPool* self, const void* object);
+
+size_t ObjectPool_availableSize(const ObjectPool* self);
+size_t ObjectPool_maxSize(const ObjectPool* self);
+
+#endif /* SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_ */
@@ -0,0 +1,87 @@
+/**
+ * @file	object_pool.h
+ * @brief	fixed-size object pool
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_
+#define SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_
+
+#include <cstddef>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @class	ObjectPool
+ * @brief	Fixed-size Object Pool class
+ * @note	Don't inherit from this class.
+ * @note	N slots for T are reserved inline. Free slots are linked through
+ *			their own storage, so acquire() and release() are O(1).
+ * @note	With isr_safe, acquire() and release() mask interrupts for a few
+ *			instructions, so the pool may be shared with ISRs.
+ */
+template <typename T, std::size_t N>
+class ObjectPool {
+
+public:
+	explicit ObjectPool(bool isr_safe = false);
+	~ObjectPool();
+
+	void* acquire();
+	void release(void* object);
+
+	T* create();
+	T* create(const T& object);
+#if (__cplusplus >= 201103L)
+	template <typename... Args>
+	T* emplace(Args&&... args);
+#endif
+	void destroy(T* object);
+
+	bool owns(const void* object) const;
+
+	std::size_t availableSize() const;
+	std::size_t maxSize() const;
+
+private:
+	ObjectPool(const ObjectPool&);
+	ObjectPool& operator=(const ObjectPool&);
+
+	/**
+	 * @union	Slot
+	 * @brief	Storage of a object, or the link to the next free slot
+	 */
+	union Slot {
+		Slot* next;
+#if (__cplusplus >= 201103L)
+		alignas(T) unsigned char object[sizeof(T)];
+#else
+		unsigned char object[sizeof(T)] __attribute__((aligned(__alignof__(T))));
+#endif
+	};
+
+	const bool kISR_SAFE;
+	std::size_t availableSize_;
+	Slot* free_;
+	Slot slots_[N];
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "object_pool_inline.h"
+
+#endif /* SDPSES_CONTAINER_OBJECT_POOL_H_INCLUDED_ */
@@ -0,0 +1,190 @@
+/**
+ * @file	object_pool_inline.h
+ * @brief	fixed-size object pool inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#include <new>
+#if (__cplusplus >= 201103L)
+#include <utility>
+#endif
+
+#include "lib_critical_section.h"
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @brief	Constructor
+ * @param	isr_safe		mask interrupts in acquire() and release()
+ */
+template <typename T, std::size_t N>
+inline ObjectPool<T, N>::ObjectPool(const bool isr_safe)
+	: kISR_SAFE(isr_safe)
+	, availableSize_(N)
+	, free_(&slots_[0])
+{
+	for (std::size_t i = 0; i < (N - 1); i++) {
+		slots_[i].next = &slots_[i + 1];
+	}
+	slots_[N - 1].next = 0;
+}
+
+/**
+ * @brief	Destructor
+ * @note	Objects still acquired are not destroyed.
+ */
+template <typename T, std::size_t N>
+inline ObjectPool<T, N>::~ObjectPool()
+{
+}
+
+/**
+ * @brief	Acquires a slot (uninitialized)
+ * @return	pointer to the slot (NULL: exhausted)
+ */
+template <typename T, std::size_t N>
+inline void* ObjectPool<T, N>::acquire()
+{
+	const lib_critical_section_t context = (kISR_SAFE) ? lib_critical_section_enter() : 0;
+
+	Slot* const slot = free_;
+	if (slot) {
+		free_ = slot->next;
+		availableSize_--;
+	}
+
+	if (kISR_SAFE) { lib_critical_section_exit(context); }
+
+	return slot;
+}
+
+/**
+ * @brief	Releases a slot
+ * @param	object			pointer returned by acquire() (NULL is ignored)
+ * @return	none
+ *
+ * @pre owns(object)
+ */
+template <typename T, std::size_t N>
+inline void ObjectPool<T, N>::release(void* const object)
+{
+	if (!object) { return; }
+
+	Slot* const slot = static_cast<Slot*>(object);
+	const lib_critical_section_t context = (kISR_SAFE) ? lib_critical_section_enter() : 0;
+
+	slot->next = free_;
+	free_ = slot;
+	availableSize_++;
+
+	if (kISR_SAFE) { lib_critical_section_exit(context); }
+}
+
+/**
+ * @brief	Creates a default-constructed object
+ * @return	pointer to the object (NULL: exhausted)
+ */
+template <typename T, std::size_t N>
+inline T* ObjectPool<T, N>::create()
+{
+	void* const slot = acquire();
+	return (slot) ? new(slot) T() : 0;
+}
+
+/**
+ * @brief	Creates a copy of the object
+ * @param	object			source object
+ * @return	pointer to the object (NULL: exhausted)
+ */
+template <typename T, std::size_t N>
+inline T* ObjectPool<T, N>::create(const T& object)
+{
+	void* const slot = acquire();
+	return (slot) ? new(slot) T(object) : 0;
+}
+
+#if (__cplusplus >= 201103L)
+/**
+ * @brief	Creates a object in place
+ * @param	args			constructor arguments
+ * @return	pointer to the object (NULL: exhausted)
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+inline T* ObjectPool<T, N>::emplace(Args&&... args)
+{
+	void* const slot = acquire();
+	return (slot) ? new(slot) T(std::forward<Args>(args)...) : nullptr;
+}
+#endif
+
+/**
+ * @brief	Destroys the object and releases its slot
+ * @param	object			pointer returned by create() (NULL is ignored)
+ * @return	none
+ *
+ * @pre owns(object)
+ */
+template <typename T, std::size_t N>
+inline void ObjectPool<T, N>::destroy(T* const object)
+{
+	if (!object) { return; }
+
+	object->~T();
+	release(object);
+}
+
+/**
+ * @brief	Is the pointer a slot of this pool
+ * @param	object			pointer
+ * @retval	true			owned
+ * @retval	false			not owned
+ */
+template <typename T, std::size_t N>
+inline bool ObjectPool<T, N>::owns(const void* const object) const
+{
+	const unsigned char* const p = static_cast<const unsigned char*>(object);
+	const unsigned char* const first = reinterpret_cast<const unsigned char*>(&slots_[0]);
+	const unsigned char* const last = reinterpret_cast<const unsigned char*>(&slots_[N]);
+
+	if ((p < first) || (p >= last)) { return false; }
+	return ((static_cast<std::size_t>(p - first) % sizeof(Slot)) == 0) ? true : false;
+}
+
+/**
+ * @brief	Returns the number of free slots
+ * @return	the number of free slots
+ */
+template <typename T, std::size_t N>
+inline std::size_t ObjectPool<T, N>::availableSize() const
+{
+	return availableSize_;
+}
+
+/**
+ * @brief	Returns the number of slots
+ * @return	the number of slots
+ */
+template <typename T, std::size_t N>
+inline std::size_t ObjectPool<T, N>::maxSize() const
+{
+	return N;
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
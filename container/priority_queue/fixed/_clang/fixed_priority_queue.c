@@ -0,0 +1,379 @@
+/**
+ * @file	fixed_priority_queue.c
+ * @brief	fixed-size priority queue
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "allocator.h"
+
+#include "fixed_priority_queue.h"
+#include "lib_assert.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	FixedPriorityQueue
+ * @brief	FixedPriorityQueue struct (binary heap)
+ * @note	The top is the element that no other element is greater than by the
+ *			less function. Compare deadlines the other way round to take the
+ *			earliest first.
+ * @note	Push returns a handle that stays valid until the element is popped
+ *			or removed. Update and remove use it in O(log n).
+ * @note	Not interrupt safe: mask interrupts if an ISR shares the queue.
+ */
+struct FixedPriorityQueue {
+	size_t sizeMax;
+	size_t elementSize;
+	size_t size;
+	size_t freeHandle;		/*!< head of the free handle list */
+	FixedPriorityQueue_LessFunc less;
+	uint8_t* elements;		/*!< indexed by handle */
+	size_t* heap;			/*!< heap position -> handle */
+	size_t* position;		/*!< handle -> heap position (next free handle if unused) */
+};
+
+static inline void* element_at(const FixedPriorityQueue* const self, const size_t handle) {
+	return &self->elements[handle * self->elementSize];
+}
+
+static inline bool before(const FixedPriorityQueue* const self, const size_t lhs, const size_t rhs) {
+	return self->less(element_at(self, rhs), element_at(self, lhs));
+}
+
+static inline void place(FixedPriorityQueue* const self, const size_t position, const size_t handle) {
+	self->heap[position] = handle;
+	self->position[handle] = position;
+}
+
+static void sift_up(FixedPriorityQueue* const self, size_t position)
+{
+	const size_t handle = self->heap[position];
+
+	while (position > 0) {
+		const size_t parent = (position - 1) / 2;
+		if (!before(self, handle, self->heap[parent])) { break; }
+		place(self, position, self->heap[parent]);
+		position = parent;
+	}
+	place(self, position, handle);
+}
+
+static void sift_down(FixedPriorityQueue* const self, size_t position)
+{
+	const size_t handle = self->heap[position];
+
+	for (;;) {
+		size_t child = (position * 2) + 1;
+		if (child >= self->size) { break; }
+		if (((child + 1) < self->size) && before(self, self->heap[child + 1], self->heap[child])) { child++; }
+		if (!before(self, self->heap[child], handle)) { break; }
+		place(self, position, self->heap[child]);
+		position = child;
+	}
+	place(self, position, handle);
+}
+
+static void remove_at(FixedPriorityQueue* const self, const size_t position)
+{
+	const size_t handle = self->heap[position];
+
+	self->size--;
+	if (position != self->size) {
+		const size_t moved = self->heap[self->size];
+		place(self, position, moved);
+		sift_up(self, position);
+		sift_down(self, self->position[moved]);
+	}
+
+	self->position[handle] = self->freeHandle;
+	self->freeHandle = handle;
+}
+
+/**
+ * @brief	Get the size of FixedPriorityQueue
+ * @return	the size of FixedPriorityQueue
+ */
+size_t FixedPriorityQueue_sizeOf(void)
+{
+	return sizeof(FixedPriorityQueue);
+}
+
+/**
+ * @brief	Create
+ * @param	size_max		the maximum number of elements
+ * @param	element_size	element size [byte]
+ * @param	less			comparison function
+ * @return	instance
+ */
+FixedPriorityQueue* FixedPriorityQueue_create(const size_t size_max, const size_t element_size,
+		const FixedPriorityQueue_LessFunc less)
+{
+	FixedPriorityQueue* const instance = Allocator_allocate(sizeof(FixedPriorityQueue));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (FixedPriorityQueue_ctor(instance, size_max, element_size, less)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			FixedPriorityQueue*
+ * @return	FixedPriorityQueue*
+ */
+FixedPriorityQueue* FixedPriorityQueue_destroy(FixedPriorityQueue* const self)
+{
+	if (!self) { return NULL; }
+
+	FixedPriorityQueue_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			FixedPriorityQueue*
+ * @param	size_max		the maximum number of elements
+ * @param	element_size	element size [byte]
+ * @param	less			comparison function
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int FixedPriorityQueue_ctor(FixedPriorityQueue* const self, const size_t size_max, const size_t element_size,
+		const FixedPriorityQueue_LessFunc less)
+{
+	if ((size_max == 0) || (element_size == 0) || !less) { return 1; }
+
+	/* elements first, then the index arrays aligned to size_t */
+	const size_t elementsBytes = ((element_size * size_max) + (sizeof(size_t) - 1)) & ~(sizeof(size_t) - 1);
+
+	self->sizeMax = size_max;
+	self->elementSize = element_size;
+	self->less = less;
+	self->elements = Allocator_allocate(elementsBytes + (sizeof(size_t) * size_max * 2));
+	if (!self->elements) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+	self->heap = (size_t*)&self->elements[elementsBytes];
+	self->position = &self->heap[size_max];
+
+	FixedPriorityQueue_clear(self);
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			FixedPriorityQueue*
+ * @return	none
+ */
+void FixedPriorityQueue_dtor(FixedPriorityQueue* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->elements);
+}
+
+/**
+ * @brief	Removes all elements
+ * @param	self			FixedPriorityQueue*
+ * @return	none
+ * @note	All handles become invalid.
+ */
+void FixedPriorityQueue_clear(FixedPriorityQueue* const self)
+{
+	for (size_t i = 0; i < self->sizeMax; i++) {
+		self->position[i] = i + 1;
+	}
+	self->position[self->sizeMax - 1] = kFIXED_PRIORITY_QUEUE_INVALID_HANDLE;
+	self->freeHandle = 0;
+	self->size = 0;
+}
+
+/**
+ * @brief	Inserts a element
+ * @param	self			FixedPriorityQueue*
+ * @param	element			pointer to the element (elementSize bytes)
+ * @return	handle of the inserted element
+ *
+ * @pre not full
+ */
+size_t FixedPriorityQueue_push(FixedPriorityQueue* const self, const void* const element)
+{
+	ASSERT_(self->size < self->sizeMax);
+
+	const size_t handle = self->freeHandle;
+	self->freeHandle = self->position[handle];
+
+	memcpy(element_at(self, handle), element, self->elementSize);
+	place(self, self->size, handle);
+	sift_up(self, self->size++);
+
+	return handle;
+}
+
+/**
+ * @brief	Removes the top element
+ * @param	self			FixedPriorityQueue*
+ * @return	none
+ *
+ * @pre not empty
+ */
+void FixedPriorityQueue_pop(FixedPriorityQueue* const self)
+{
+	ASSERT_(self->size > 0);
+
+	remove_at(self, 0);
+}
+
+/**
+ * @brief	Returns the top element
+ * @param	self			FixedPriorityQueue*
+ * @return	a pointer to the top element
+ *
+ * @pre not empty
+ */
+const void* FixedPriorityQueue_top(const FixedPriorityQueue* const self)
+{
+	ASSERT_(self->size > 0);
+
+	return element_at(self, self->heap[0]);
+}
+
+/**
+ * @brief	Returns the handle of the top element
+ * @param	self			FixedPriorityQueue*
+ * @return	handle of the top element
+ *
+ * @pre not empty
+ */
+size_t FixedPriorityQueue_topHandle(const FixedPriorityQueue* const self)
+{
+	ASSERT_(self->size > 0);
+
+	return self->heap[0];
+}
+
+/**
+ * @brief	Returns the element of the handle
+ * @param	self			FixedPriorityQueue*
+ * @param	handle			handle returned by FixedPriorityQueue_push()
+ * @return	a pointer to the element
+ *
+ * @pre FixedPriorityQueue_contains(handle)
+ */
+const void* FixedPriorityQueue_get(const FixedPriorityQueue* const self, const size_t handle)
+{
+	ASSERT_(FixedPriorityQueue_contains(self, handle));
+
+	return element_at(self, handle);
+}
+
+/**
+ * @brief	Replaces the element of the handle and restores the order
+ * @param	self			FixedPriorityQueue*
+ * @param	handle			handle returned by FixedPriorityQueue_push()
+ * @param	element			pointer to the new element (e.g. an earlier or later deadline)
+ * @return	none
+ *
+ * @pre FixedPriorityQueue_contains(handle)
+ */
+void FixedPriorityQueue_update(FixedPriorityQueue* const self, const size_t handle, const void* const element)
+{
+	ASSERT_(FixedPriorityQueue_contains(self, handle));
+
+	memcpy(element_at(self, handle), element, self->elementSize);
+	sift_up(self, self->position[handle]);
+	sift_down(self, self->position[handle]);
+}
+
+/**
+ * @brief	Removes the element of the handle
+ * @param	self			FixedPriorityQueue*
+ * @param	handle			handle returned by FixedPriorityQueue_push()
+ * @return	none
+ *
+ * @pre FixedPriorityQueue_contains(handle)
+ */
+void FixedPriorityQueue_remove(FixedPriorityQueue* const self, const size_t handle)
+{
+	ASSERT_(FixedPriorityQueue_contains(self, handle));
+
+	remove_at(self, self->position[handle]);
+}
+
+/**
+ * @brief	Is the handle in the queue
+ * @param	self			FixedPriorityQueue*
+ * @param	handle			handle
+ * @retval	true			in the queue
+ * @retval	false			popped, removed or invalid
+ */
+bool FixedPriorityQueue_contains(const FixedPriorityQueue* const self, const size_t handle)
+{
+	if (handle >= self->sizeMax) { return false; }
+
+	const size_t position = self->position[handle];
+	return ((position < self->size) && (self->heap[position] == handle)) ? true : false;
+}
+
+/**
+ * @brief	Is empty
+ * @param	self			FixedPriorityQueue*
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+bool FixedPriorityQueue_empty(const FixedPriorityQueue* const self)
+{
+	return (self->size) ? false : true;
+}
+
+/**
+ * @brief	Is full
+ * @param	self			FixedPriorityQueue*
+ * @retval	true			full
+ * @retval	false			not full
+ */
+bool FixedPriorityQueue_full(const FixedPriorityQueue* const self)
+{
+	return (self->size < self->sizeMax) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of elements
+ * @param	self			FixedPriorityQueue*
+ * @return	the number of elements
+ */
+size_t FixedPriorityQueue_size(const FixedPriorityQueue* const self)
+{
+	return self->size;
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @param	self			FixedPriorityQueue*
+ * @return	the maximum number of elements
+ */
+size_t FixedPriorityQueue_maxSize(const FixedPriorityQueue* const self)
+{
+	return self->sizeMax;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file	fixed_priority_queue.h
+ * @brief	fixed-size priority queue
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct FixedPriorityQueue;
+typedef struct FixedPriorityQueue FixedPriorityQueue;
+
+/**
+ * @brief	Comparison Function
+ * @param	lhs				pointer to a element
+ * @param	rhs				pointer to a element
+ * @retval	true			lhs has the lower priority than rhs
+ * @retval	false			otherwise
+ */
+typedef bool (*FixedPriorityQueue_LessFunc)(const void* lhs, const void* rhs);
+
+static const size_t kFIXED_PRIORITY_QUEUE_INVALID_HANDLE = (size_t)-1;
+
+size_t FixedPriorityQueue_sizeOf(void);
+
+FixedPriorityQueue* FixedPriorityQueue_create(size_t size_max, size_t element_size, FixedPriorityQueue_LessFunc less);
+FixedPriorityQueue* FixedPriorityQueue_destroy(FixedPriorityQueue* self);
+
+int FixedPriorityQueue_ctor(FixedPriorityQueue* self, size_t size_max, size_t element_size, FixedPriorityQueue_LessFunc less);
+void FixedPriorityQueue_dtor(FixedPriorityQueue* self);
+
+void FixedPriorityQueue_clear(FixedPriorityQueue* self);
+size_t FixedPriorityQueue_push(FixedPriorityQueue* self, const void* element);
+void FixedPriorityQueue_pop(FixedPriorityQueue* self);
+const void* FixedPriorityQueue_top(const FixedPriorityQueue* self);
+size_t FixedPriorityQueue_topHandle(const FixedPriorityQueue* self);
+
+const void* FixedPriorityQueue_get(const FixedPriorityQueue* self, size_t handle);
+void FixedPriorityQueue_update(FixedPriorityQueue* self, size_t handle, const void* element);
+void FixedPriorityQueue_remove(FixedPriorityQueue* self, size_t handle);
+bool FixedPriorityQueue_contains(const FixedPriorityQueue* self, size_t handle);
+
+bool FixedPriorityQueue_empty(const FixedPriorityQueue* self);
+bool FixedPriorityQueue_full(const FixedPriorityQueue* self);
+
+size_t FixedPriorityQueue_size(const FixedPriorityQueue* self);
+size_t FixedPriorityQueue_maxSize(const FixedPriorityQueue* self);
+
+#endif /* SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_ */
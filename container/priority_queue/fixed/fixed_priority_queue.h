@@ -0,0 +1,93 @@
+/**
+ * @file	fixed_priority_queue.h
+ * @brief	fixed-size priority queue
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_
+
+#include <cstddef>
+#include <functional>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @class	FixedPriorityQueue
+ * @brief	Fixed-size Priority Queue class (binary heap)
+ * @note	Don't inherit from this class.
+ * @note	As with std::priority_queue, top() is the element that no other
+ *			element is greater than by Compare. Use std::greater<T> to take the
+ *			earliest deadline first.
+ * @note	push() returns a handle that stays valid until the element is
+ *			popped or removed. update() and remove() use it in O(log n).
+ * @note	The storage is allocated once at construction.
+ *			Not interrupt safe: mask interrupts if an ISR shares the queue.
+ */
+template <typename T, typename Compare = std::less<T> >
+class FixedPriorityQueue {
+
+public:
+	typedef std::size_t Handle;
+	static const Handle kINVALID_HANDLE = static_cast<Handle>(-1);
+
+	explicit FixedPriorityQueue(std::size_t size_max, const Compare& compare = Compare());
+	~FixedPriorityQueue();
+
+	void clear();
+	Handle push(const T& element);
+	void pop();
+	const T& top() const;
+	Handle topHandle() const;
+
+	const T& get(Handle handle) const;
+	void update(Handle handle, const T& element);
+	void remove(Handle handle);
+	bool contains(Handle handle) const;
+
+	bool empty() const;
+	bool full() const;
+
+	std::size_t size() const;
+	std::size_t maxSize() const;
+
+private:
+	FixedPriorityQueue(const FixedPriorityQueue&);
+	FixedPriorityQueue& operator=(const FixedPriorityQueue&);
+
+	void place(std::size_t position, Handle handle);
+	void siftUp(std::size_t position);
+	void siftDown(std::size_t position);
+	void removeAt(std::size_t position);
+	bool before(Handle lhs, Handle rhs) const;
+	static void* allocate(std::size_t size);
+	static void deallocate(void* p);
+
+	const std::size_t kSIZE_MAX;
+	const Compare compare_;
+	std::size_t size_;
+	Handle freeHandle_;		/*!< head of the free handle list */
+	T* const elements_;		/*!< indexed by handle */
+	Handle* const heap_;	/*!< heap position -> handle */
+	std::size_t* const position_;	/*!< handle -> heap position (next free handle if unused) */
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "fixed_priority_queue_inline.h"
+
+#endif /* SDPSES_CONTAINER_FIXED_PRIORITY_QUEUE_H_INCLUDED_ */
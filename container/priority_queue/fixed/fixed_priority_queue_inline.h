@@ -0,0 +1,358 @@
+/**
+ * @file	fixed_priority_queue_inline.h
+ * @brief	fixed-size priority queue inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+#include "allocator.h"
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
+
+#include <new>
+
+namespace sdpses {
+
+namespace container {
+
+template <typename T, typename Compare>
+const typename FixedPriorityQueue<T, Compare>::Handle FixedPriorityQueue<T, Compare>::kINVALID_HANDLE;
+
+/**
+ * @brief	Constructor
+ * @param	size_max		the maximum number of elements
+ * @param	compare			comparison function object
+ */
+template <typename T, typename Compare>
+inline FixedPriorityQueue<T, Compare>::FixedPriorityQueue(const std::size_t size_max, const Compare& compare)
+	: kSIZE_MAX(size_max)
+	, compare_(compare)
+	, size_(0)
+	, freeHandle_(kINVALID_HANDLE)
+	, elements_(static_cast<T*>(allocate(sizeof(T) * size_max)))
+	, heap_(static_cast<Handle*>(allocate(sizeof(Handle) * size_max)))
+	, position_(static_cast<std::size_t*>(allocate(sizeof(std::size_t) * size_max)))
+{
+	clear();
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename T, typename Compare>
+inline FixedPriorityQueue<T, Compare>::~FixedPriorityQueue()
+{
+	clear();
+	deallocate(position_);
+	deallocate(heap_);
+	deallocate(elements_);
+}
+
+/**
+ * @brief	Removes all elements
+ * @return	none
+ * @note	All handles become invalid.
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::clear()
+{
+	for (std::size_t i = 0; i < size_; i++) {
+		elements_[heap_[i]].~T();
+	}
+	size_ = 0;
+
+	for (std::size_t i = 0; i < kSIZE_MAX; i++) {
+		position_[i] = i + 1;
+	}
+	if (kSIZE_MAX) { position_[kSIZE_MAX - 1] = kINVALID_HANDLE; }
+	freeHandle_ = (kSIZE_MAX) ? 0 : kINVALID_HANDLE;
+}
+
+/**
+ * @brief	Inserts a element
+ * @param	element			element
+ * @return	handle of the inserted element
+ *
+ * @pre not full
+ */
+template <typename T, typename Compare>
+inline typename FixedPriorityQueue<T, Compare>::Handle FixedPriorityQueue<T, Compare>::push(const T& element)
+{
+	const Handle handle = freeHandle_;
+	freeHandle_ = position_[handle];
+
+	new(&elements_[handle]) T(element);
+	place(size_, handle);
+	siftUp(size_++);
+
+	return handle;
+}
+
+/**
+ * @brief	Removes the top element
+ * @return	none
+ *
+ * @pre not empty
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::pop()
+{
+	removeAt(0);
+}
+
+/**
+ * @brief	Returns a reference to the top element
+ * @return	a reference to the top element
+ *
+ * @pre not empty
+ */
+template <typename T, typename Compare>
+inline const T& FixedPriorityQueue<T, Compare>::top() const
+{
+	return elements_[heap_[0]];
+}
+
+/**
+ * @brief	Returns the handle of the top element
+ * @return	handle of the top element
+ *
+ * @pre not empty
+ */
+template <typename T, typename Compare>
+inline typename FixedPriorityQueue<T, Compare>::Handle FixedPriorityQueue<T, Compare>::topHandle() const
+{
+	return heap_[0];
+}
+
+/**
+ * @brief	Returns a reference to the element of the handle
+ * @param	handle			handle returned by push()
+ * @return	a reference to the element
+ *
+ * @pre contains(handle)
+ */
+template <typename T, typename Compare>
+inline const T& FixedPriorityQueue<T, Compare>::get(const Handle handle) const
+{
+	return elements_[handle];
+}
+
+/**
+ * @brief	Replaces the element of the handle and restores the order
+ * @param	handle			handle returned by push()
+ * @param	element			new element (e.g. an earlier or later deadline)
+ * @return	none
+ *
+ * @pre contains(handle)
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::update(const Handle handle, const T& element)
+{
+	elements_[handle] = element;
+	siftUp(position_[handle]);
+	siftDown(position_[handle]);
+}
+
+/**
+ * @brief	Removes the element of the handle
+ * @param	handle			handle returned by push()
+ * @return	none
+ *
+ * @pre contains(handle)
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::remove(const Handle handle)
+{
+	removeAt(position_[handle]);
+}
+
+/**
+ * @brief	Is the handle in the queue
+ * @param	handle			handle
+ * @retval	true			in the queue
+ * @retval	false			popped, removed or invalid
+ */
+template <typename T, typename Compare>
+inline bool FixedPriorityQueue<T, Compare>::contains(const Handle handle) const
+{
+	if (handle >= kSIZE_MAX) { return false; }
+
+	const std::size_t position = position_[handle];
+	return ((position < size_) && (heap_[position] == handle)) ? true : false;
+}
+
+/**
+ * @brief	Is empty
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+template <typename T, typename Compare>
+inline bool FixedPriorityQueue<T, Compare>::empty() const
+{
+	return (size_) ? false : true;
+}
+
+/**
+ * @brief	Is full
+ * @retval	true			full
+ * @retval	false			not full
+ */
+template <typename T, typename Compare>
+inline bool FixedPriorityQueue<T, Compare>::full() const
+{
+	return (size_ < kSIZE_MAX) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of elements
+ * @return	the number of elements
+ */
+template <typename T, typename Compare>
+inline std::size_t FixedPriorityQueue<T, Compare>::size() const
+{
+	return size_;
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @return	the maximum number of elements
+ */
+template <typename T, typename Compare>
+inline std::size_t FixedPriorityQueue<T, Compare>::maxSize() const
+{
+	return kSIZE_MAX;
+}
+
+/**
+ * @brief	Puts the handle at the heap position
+ * @param	position		heap position
+ * @param	handle			handle
+ * @return	none
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::place(const std::size_t position, const Handle handle)
+{
+	heap_[position] = handle;
+	position_[handle] = position;
+}
+
+/**
+ * @brief	Moves the element at the heap position toward the top
+ * @param	position		heap position
+ * @return	none
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::siftUp(std::size_t position)
+{
+	const Handle handle = heap_[position];
+
+	while (position > 0) {
+		const std::size_t parent = (position - 1) / 2;
+		if (!before(handle, heap_[parent])) { break; }
+		place(position, heap_[parent]);
+		position = parent;
+	}
+	place(position, handle);
+}
+
+/**
+ * @brief	Moves the element at the heap position toward the bottom
+ * @param	position		heap position
+ * @return	none
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::siftDown(std::size_t position)
+{
+	const Handle handle = heap_[position];
+
+	for (;;) {
+		std::size_t child = (position * 2) + 1;
+		if (child >= size_) { break; }
+		if (((child + 1) < size_) && before(heap_[child + 1], heap_[child])) { child++; }
+		if (!before(heap_[child], handle)) { break; }
+		place(position, heap_[child]);
+		position = child;
+	}
+	place(position, handle);
+}
+
+/**
+ * @brief	Removes the element at the heap position
+ * @param	position		heap position
+ * @return	none
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::removeAt(const std::size_t position)
+{
+	const Handle handle = heap_[position];
+
+	elements_[handle].~T();
+	size_--;
+	if (position != size_) {
+		const Handle moved = heap_[size_];
+		place(position, moved);
+		siftUp(position);
+		siftDown(position_[moved]);
+	}
+
+	position_[handle] = freeHandle_;
+	freeHandle_ = handle;
+}
+
+/**
+ * @brief	Does the element of lhs come before that of rhs
+ * @param	lhs				handle
+ * @param	rhs				handle
+ * @retval	true			lhs has the higher priority
+ * @retval	false			otherwise
+ */
+template <typename T, typename Compare>
+inline bool FixedPriorityQueue<T, Compare>::before(const Handle lhs, const Handle rhs) const
+{
+	return compare_(elements_[rhs], elements_[lhs]);
+}
+
+/**
+ * @brief	Allocates raw storage
+ * @param	size			size [byte]
+ * @return	pointer to the storage
+ */
+template <typename T, typename Compare>
+inline void* FixedPriorityQueue<T, Compare>::allocate(const std::size_t size)
+{
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	return Allocator_allocate(size);
+#else
+	return ::operator new(size);
+#endif
+}
+
+/**
+ * @brief	Deallocates raw storage
+ * @param	p				pointer to the storage
+ * @return	none
+ */
+template <typename T, typename Compare>
+inline void FixedPriorityQueue<T, Compare>::deallocate(void* const p)
+{
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	Allocator_deallocate(p);
+#else
+	::operator delete(p);
+#endif
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
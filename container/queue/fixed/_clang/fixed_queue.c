@@ -0,0 +1,409 @@
+/**
+ * @file	fixed_queue.c
+ * @brief	fixed-size queue
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "allocator.h"
+
+#include "fixed_queue.h"
+#include "lib_assert.h"
+#include "lib_barrier.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	FixedQueue
+ * @brief	FixedQueue struct
+ * @note	The element size is given at construction. Sizes 1, 2, 4 and 8 are
+ *			copied with fixed-size moves instead of a variable-length memcpy.
+ * @note	Single-producer/single-consumer safe: push and pop may be called
+ *			from different contexts (e.g. ISR and main loop) without masking
+ *			interrupts, since only the producer writes tail and only the consumer
+ *			writes head.
+ */
+struct FixedQueue {
+	size_t sizeMax;
+	size_t elementSize;
+	size_t head;	/*!< written by the consumer only [0, 2 * sizeMax) */
+	size_t tail;	/*!< written by the producer only [0, 2 * sizeMax) */
+	uint8_t* elements;
+};
+
+/*! @note Indexes run over twice the capacity so that full and empty differ. */
+static inline size_t next_index(const FixedQueue* const self, const size_t index) {
+	return ((index + 1) == (self->sizeMax * 2)) ? 0 : (index + 1);
+}
+
+static inline size_t advance_index(const FixedQueue* const self, const size_t index, const size_t count) {
+	const size_t advanced = index + count;
+	return (advanced < (self->sizeMax * 2)) ? advanced : (advanced - (self->sizeMax * 2));
+}
+
+static inline size_t min_size(const size_t a, const size_t b) {
+	return (a < b) ? a : b;
+}
+
+static inline size_t slot(const FixedQueue* const self, const size_t index) {
+	return (index < self->sizeMax) ? index : (index - self->sizeMax);
+}
+
+static inline uint8_t* element_at(const FixedQueue* const self, const size_t slot_index) {
+	return &self->elements[slot_index * self->elementSize];
+}
+
+static inline size_t current_size(const FixedQueue* const self) {
+	const size_t head = self->head;
+	const size_t tail = self->tail;
+	lib_barrier_acquire();
+	return (tail >= head) ? (tail - head) : ((tail + (self->sizeMax * 2)) - head);
+}
+
+/*! @note Constant-size memcpy compiles to a single load/store pair. */
+static inline void copy_element(void* const dst, const void* const src, const size_t element_size) {
+	switch (element_size) {
+	case 1: memcpy(dst, src, 1); break;
+	case 2: memcpy(dst, src, 2); break;
+	case 4: memcpy(dst, src, 4); break;
+	case 8: memcpy(dst, src, 8); break;
+	default: memcpy(dst, src, element_size); break;
+	}
+}
+
+/**
+ * @brief	Get the size of FixedQueue
+ * @return	the size of FixedQueue
+ */
+size_t FixedQueue_sizeOf(void)
+{
+	return sizeof(FixedQueue);
+}
+
+/**
+ * @brief	Create
+ * @param	size_max		the maximum number of elements
+ * @param	element_size	element size [byte]
+ * @return	instance
+ */
+FixedQueue* FixedQueue_create(const size_t size_max, const size_t element_size)
+{
+	FixedQueue* const instance = Allocator_allocate(sizeof(FixedQueue));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (FixedQueue_ctor(instance, size_max, element_size)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			FixedQueue*
+ * @return	FixedQueue*
+ */
+FixedQueue* FixedQueue_destroy(FixedQueue* const self)
+{
+	if (!self) { return NULL; }
+
+	FixedQueue_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			FixedQueue*
+ * @param	size_max		the maximum number of elements
+ * @param	element_size	element size [byte]
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int FixedQueue_ctor(FixedQueue* const self, const size_t size_max, const size_t element_size)
+{
+	if ((size_max == 0) || (element_size == 0)) { return 1; }
+
+	self->sizeMax = size_max;
+	self->elementSize = element_size;
+	self->elements = Allocator_allocate(element_size * size_max);
+	if (!self->elements) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+
+	FixedQueue_clear(self);
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			FixedQueue*
+ * @return	none
+ */
+void FixedQueue_dtor(FixedQueue* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->elements);
+}
+
+/**
+ * @brief	Removes all elements
+ * @param	self			FixedQueue*
+ * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
+ */
+void FixedQueue_clear(FixedQueue* const self)
+{
+	self->head = 0;
+	self->tail = 0;
+	lib_barrier_release();
+}
+
+/**
+ * @brief	Inserts a element
+ * @param	self			FixedQueue*
+ * @param	element			pointer to the element (elementSize bytes)
+ * @return	none
+ *
+ * @pre not full
+ */
+void FixedQueue_push(FixedQueue* const self, const void* const element)
+{
+	ASSERT_(current_size(self) < self->sizeMax);
+
+	const size_t tail = self->tail;
+	copy_element(element_at(self, slot(self, tail)), element, self->elementSize);
+	lib_barrier_release();
+	self->tail = next_index(self, tail);
+}
+
+/**
+ * @brief	Inserts elements
+ * @param	self			FixedQueue*
+ * @param	elements		elements
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre availableSize >= count
+ */
+void FixedQueue_pushN(FixedQueue* const self, const void* const elements, const size_t count)
+{
+	ASSERT_((self->sizeMax - current_size(self)) >= count);
+
+	const uint8_t* const src = elements;
+	const size_t tail = self->tail;
+	const size_t first = slot(self, tail);
+	const size_t firstCount = min_size(count, (self->sizeMax - first));
+
+	memcpy(element_at(self, first), &src[0], (firstCount * self->elementSize));
+	memcpy(element_at(self, 0), &src[firstCount * self->elementSize], ((count - firstCount) * self->elementSize));
+	lib_barrier_release();
+	self->tail = advance_index(self, tail, count);
+}
+
+/**
+ * @brief	Removes the next element
+ * @param	self			FixedQueue*
+ * @return	none
+ *
+ * @pre not empty
+ */
+void FixedQueue_pop(FixedQueue* const self)
+{
+	ASSERT_(current_size(self) > 0);
+
+	const size_t head = self->head;
+	lib_barrier_release();
+	self->head = next_index(self, head);
+}
+
+/**
+ * @brief	Removes elements into buffer
+ * @param	self			FixedQueue*
+ * @param	elements		elements buffer
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre size >= count
+ */
+void FixedQueue_popN(FixedQueue* const self, void* const elements, const size_t count)
+{
+	ASSERT_(current_size(self) >= count);
+
+	uint8_t* const dst = elements;
+	const size_t head = self->head;
+	const size_t first = slot(self, head);
+	const size_t firstCount = min_size(count, (self->sizeMax - first));
+
+	if (count == 1) {
+		copy_element(dst, element_at(self, first), self->elementSize);
+	} else {
+		memcpy(&dst[0], element_at(self, first), (firstCount * self->elementSize));
+		memcpy(&dst[firstCount * self->elementSize], element_at(self, 0), ((count - firstCount) * self->elementSize));
+	}
+	lib_barrier_release();
+	self->head = advance_index(self, head, count);
+}
+
+/**
+ * @brief	Returns the next element
+ * @param	self			FixedQueue*
+ * @return	a pointer to the next element
+ *
+ * @pre not empty
+ */
+void* FixedQueue_front(const FixedQueue* const self)
+{
+	ASSERT_(current_size(self) > 0);
+
+	return element_at(self, slot(self, self->head));
+}
+
+/**
+ * @brief	Returns the contiguous readable elements
+ * @param	self			FixedQueue*
+ * @param	span_size		pointer to the number of readable elements
+ * @return	a pointer to the next element
+ *
+ * @note Only the part up to the end of storage is returned. Call
+ *       FixedQueue_commitRead() and then this again to get the part that
+ *       wrapped around.
+ */
+void* FixedQueue_readableSpan(FixedQueue* const self, size_t* const span_size)
+{
+	const size_t first = slot(self, self->head);
+	*span_size = min_size(current_size(self), (self->sizeMax - first));
+	return element_at(self, first);
+}
+
+/**
+ * @brief	Returns the contiguous writable elements
+ * @param	self			FixedQueue*
+ * @param	span_size		pointer to the number of writable elements
+ * @return	a pointer to the next free element
+ *
+ * @note Only the part up to the end of storage is returned. Call
+ *       FixedQueue_commitWrite() and then this again to get the part that
+ *       wrapped around.
+ */
+void* FixedQueue_writableSpan(FixedQueue* const self, size_t* const span_size)
+{
+	const size_t first = slot(self, self->tail);
+	*span_size = min_size((self->sizeMax - current_size(self)), (self->sizeMax - first));
+	return element_at(self, first);
+}
+
+/**
+ * @brief	Removes elements read through FixedQueue_readableSpan()
+ * @param	self			FixedQueue*
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by FixedQueue_readableSpan()
+ */
+void FixedQueue_commitRead(FixedQueue* const self, const size_t count)
+{
+	ASSERT_(current_size(self) >= count);
+
+	const size_t head = self->head;
+	lib_barrier_release();
+	self->head = advance_index(self, head, count);
+}
+
+/**
+ * @brief	Inserts elements written through FixedQueue_writableSpan()
+ * @param	self			FixedQueue*
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by FixedQueue_writableSpan()
+ */
+void FixedQueue_commitWrite(FixedQueue* const self, const size_t count)
+{
+	ASSERT_((self->sizeMax - current_size(self)) >= count);
+
+	const size_t tail = self->tail;
+	lib_barrier_release();
+	self->tail = advance_index(self, tail, count);
+}
+
+/**
+ * @brief	Is empty
+ * @param	self			FixedQueue*
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+bool FixedQueue_empty(const FixedQueue* const self)
+{
+	return (current_size(self)) ? false : true;
+}
+
+/**
+ * @brief	Is full
+ * @param	self			FixedQueue*
+ * @retval	true			full
+ * @retval	false			not full
+ */
+bool FixedQueue_full(const FixedQueue* const self)
+{
+	return (current_size(self) < self->sizeMax) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of elements
+ * @param	self			FixedQueue*
+ * @return	the number of elements
+ */
+size_t FixedQueue_size(const FixedQueue* const self)
+{
+	return current_size(self);
+}
+
+/**
+ * @brief	Returns the number of storable elements
+ * @param	self			FixedQueue*
+ * @return	the number of storable elements
+ */
+size_t FixedQueue_availableSize(const FixedQueue* const self)
+{
+	return (self->sizeMax - current_size(self));
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @param	self			FixedQueue*
+ * @return	the maximum number of elements
+ */
+size_t FixedQueue_maxSize(const FixedQueue* const self)
+{
+	return self->sizeMax;
+}
+
+/**
+ * @brief	Returns the element size
+ * @param	self			FixedQueue*
+ * @return	element size [byte]
+ */
+size_t FixedQueue_elementSize(const FixedQueue* const self)
+{
+	return self->elementSize;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file	fixed_queue.h
+ * @brief	fixed-size queue
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_QUEUE_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_QUEUE_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct FixedQueue;
+typedef struct FixedQueue FixedQueue;
+
+size_t FixedQueue_sizeOf(void);
+
+FixedQueue* FixedQueue_create(size_t size_max, size_t element_size);
+FixedQueue* FixedQueue_destroy(FixedQueue* self);
+
+int FixedQueue_ctor(FixedQueue* self, size_t size_max, size_t element_size);
+void FixedQueue_dtor(FixedQueue* self);
+
+void FixedQueue_clear(FixedQueue* self);
+void FixedQueue_push(FixedQueue* self, const void* element);
+void FixedQueue_pushN(FixedQueue* self, const void* elements, size_t count);
+void FixedQueue_pop(FixedQueue* self);
+void FixedQueue_popN(FixedQueue* self, void* elements, size_t count);
+void* FixedQueue_front(const FixedQueue* self);
+
+void* FixedQueue_readableSpan(FixedQueue* self, size_t* span_size);
+void* FixedQueue_writableSpan(FixedQueue* self, size_t* span_size);
+void FixedQueue_commitRead(FixedQueue* self, size_t count);
+void FixedQueue_commitWrite(FixedQueue* self, size_t count);
+
+bool FixedQueue_empty(const FixedQueue* self);
+bool FixedQueue_full(const FixedQueue* self);
+
+size_t FixedQueue_size(const FixedQueue* self);
+size_t FixedQueue_availableSize(const FixedQueue* self);
+size_t FixedQueue_maxSize(const FixedQueue* self);
+size_t FixedQueue_elementSize(const FixedQueue* self);
+
+#endif /* SDPSES_CONTAINER_FIXED_QUEUE_H_INCLUDED_ */
@@ -14,19 +14,19 @@
  * http://opensource.org/licenses/mit-license.php
  */
 
+#include <string.h>
+
 #include "allocator.h"
+#include "allocator_budget.h"
 
+#define SDPSES_CONTAINER_FIXED_QUEUE8_IMPLEMENTATION_
 #include "fixed_queue8.h"
+#include "fixed_queue8_inline.h"
 #include "lib_assert.h"
+#include "lib_barrier.h"
 #include "lib_debug.h"
 
-struct FixedQueue8 {
-	size_t sizeMax;
-	size_t head;
-	size_t tail;
-	size_t size;
-	uint8_t* elements;
-};
+ALLOCATOR_BUDGET_STATIC_ASSERT_(sizeof(FixedQueue8) <= kFIXED_QUEUE8_BUDGET_INSTANCE, fixed_queue8_instance);
 
 /**
  * @brief	Get the size of FixedQueue8
@@ -37,6 +37,29 @@ size_t FixedQueue8_sizeOf(void)
 	return sizeof(FixedQueue8);
 }
 
+/*! @note Offset of the storage in the block of the instance */
+static inline size_t storage_offset(const size_t alignment) {
+	return (alignment) ? ((sizeof(FixedQueue8) + (alignment - 1)) & ~(alignment - 1)) : sizeof(FixedQueue8);
+}
+
+/*! @note Size of the storage: padded to whole alignment units so that its range can be flushed or invalidated */
+static inline size_t storage_size(const size_t size_max, const size_t alignment) {
+	const size_t size = sizeof(uint8_t) * size_max;
+	return (alignment) ? ((size + (alignment - 1)) & ~(alignment - 1)) : size;
+}
+
+/**
+ * @brief	Get the size of the block of FixedQueue8_create()
+ * @param	size_max		the maximum number of elements
+ * @return	the size of the instance and the storage
+ *
+ * @note e.g. the object size of an ObjectCache of queues.
+ */
+size_t FixedQueue8_blockSize(const size_t size_max)
+{
+	return storage_offset(0) + (sizeof(uint8_t) * size_max);
+}
+
 /**
  * @brief	Create
  * @param	size_max		the maximum number of elements
@@ -44,16 +67,48 @@ size_t FixedQueue8_sizeOf(void)
  */
 FixedQueue8* FixedQueue8_create(const size_t size_max)
 {
-	FixedQueue8* const instance = Allocator_allocate(sizeof(FixedQueue8));
-	if (!instance) {
+	return FixedQueue8_createFrom(NULL, size_max);
+}
+
+/**
+ * @brief	Create on a heap
+ * @param	heap			heap of the instance and the storage (NULL: the default heap)
+ * @param	size_max		the maximum number of elements
+ * @return	instance
+ */
+FixedQueue8* FixedQueue8_createFrom(struct Allocator* const heap, const size_t size_max)
+{
+	return FixedQueue8_createAligned(heap, size_max, 0);
+}
+
+/**
+ * @brief	Create on a heap with aligned storage
+ * @param	heap			heap of the instance and the storage (NULL: the default heap)
+ * @param	size_max		the maximum number of elements
+ * @param	alignment		alignment of the storage (power of two, 0: the default alignment)
+ * @return	instance
+ *
+ * @note e.g. kALLOCATOR_CACHE_LINE_SIZE for storage flushed or invalidated by range (DMA).
+ * @note The instance and the storage are one block of the heap.
+ * @note The storage is padded to a multiple of the alignment, so no other data
+ *       shares its cache lines.
+ */
+FixedQueue8* FixedQueue8_createAligned(struct Allocator* const heap, const size_t size_max, const size_t alignment)
+{
+	ASSERT_((alignment & (alignment - 1)) == 0);
+
+	if (size_max == 0) { return NULL; }
+
+	const size_t offset = storage_offset(alignment);
+	uint8_t* const block = Allocator_allocateAlignedFrom(heap, offset + storage_size(size_max, alignment), alignment);
+	if (!block) {
 		FATAL_("Cannot allocate memory\r\n");
 		return NULL;
 	}
 
-	if (FixedQueue8_ctor(instance, size_max)) {
-		Allocator_deallocate(instance);
-		return NULL;
-	}
+	FixedQueue8* const instance = (FixedQueue8*)block;
+	FixedQueue8_ctorOn(instance, block + offset, size_max);
+	instance->heap = heap;
 
 	return instance;
 }
@@ -67,8 +122,9 @@ FixedQueue8* FixedQueue8_destroy(FixedQueue8* const self)
 {
 	if (!self) { return NULL; }
 
+	struct Allocator* const heap = self->heap;
 	FixedQueue8_dtor(self);
-	Allocator_deallocate(self);
+	Allocator_deallocateFrom(heap, self);
 
 	return NULL;
 }
@@ -81,11 +137,43 @@ FixedQueue8* FixedQueue8_destroy(FixedQueue8* const self)
  * @retval	!=0				failure
  */
 int FixedQueue8_ctor(FixedQueue8* const self, const size_t size_max)
+{
+	return FixedQueue8_ctorFrom(self, NULL, size_max);
+}
+
+/**
+ * @brief	Constructor with the storage on a heap
+ * @param	self			FixedQueue8*
+ * @param	heap			heap of the storage (NULL: the default heap)
+ * @param	size_max		the maximum number of elements
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int FixedQueue8_ctorFrom(FixedQueue8* const self, struct Allocator* const heap, const size_t size_max)
+{
+	return FixedQueue8_ctorAligned(self, heap, size_max, 0);
+}
+
+/**
+ * @brief	Constructor with aligned storage on a heap
+ * @param	self			FixedQueue8*
+ * @param	heap			heap of the storage (NULL: the default heap)
+ * @param	size_max		the maximum number of elements
+ * @param	alignment		alignment of the storage (power of two, 0: the default alignment)
+ * @retval	0				success
+ * @retval	!=0				failure
+ *
+ * @note The storage is padded to a multiple of the alignment, so no other data
+ *       shares its cache lines.
+ */
+int FixedQueue8_ctorAligned(FixedQueue8* const self, struct Allocator* const heap, const size_t size_max, const size_t alignment)
 {
 	if (size_max == 0) { return 1; }
 
+	self->heap = heap;
 	self->sizeMax = size_max;
-	self->elements = Allocator_allocate(sizeof(uint8_t) * size_max);
+	self->elements = Allocator_allocateAlignedFrom(heap, storage_size(size_max, alignment), alignment);
+	self->embedded = false;
 	if (!self->elements) {
 		FATAL_("Cannot allocate memory\r\n");
 		return 1;
@@ -96,6 +184,30 @@ int FixedQueue8_ctor(FixedQueue8* const self, const size_t size_max)
 	return 0;
 }
 
+/**
+ * @brief	Constructor on given storage
+ * @param	self			FixedQueue8*
+ * @param	storage			storage of size_max bytes (not released by the destructor)
+ * @param	size_max		the maximum number of elements
+ * @retval	0				success
+ * @retval	!=0				failure
+ *
+ * @note e.g. a static buffer, or the storage in the block of the owner.
+ */
+int FixedQueue8_ctorOn(FixedQueue8* const self, uint8_t storage[], const size_t size_max)
+{
+	if ((size_max == 0) || !storage) { return 1; }
+
+	self->heap = NULL;
+	self->sizeMax = size_max;
+	self->elements = storage;
+	self->embedded = true;
+
+	FixedQueue8_clear(self);
+
+	return 0;
+}
+
 /**
  * @brief	Destructor
  * @param	self			FixedQueue8*
@@ -105,19 +217,21 @@ void FixedQueue8_dtor(FixedQueue8* const self)
 {
 	if (!self) { return; }
 
-	Allocator_deallocate(self->elements);
+	if (!self->embedded) { Allocator_deallocateFrom(self->heap, self->elements); }
 }
 
 /**
  * @brief	Removes all elements
  * @param	self			FixedQueue8*
  * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
  */
 void FixedQueue8_clear(FixedQueue8* const self)
 {
 	self->head = 0;
 	self->tail = 0;
-	self->size = 0;
+	lib_barrier_release();
 }
 
 /**
@@ -130,11 +244,30 @@ void FixedQueue8_clear(FixedQueue8* const self)
  */
 void FixedQueue8_push(FixedQueue8* const self, const uint8_t element)
 {
-	ASSERT_(self->size < self->sizeMax);
+	fixed_queue8_push(self, element);
+}
 
-	self->elements[self->tail] = element;
-	if (++self->tail == self->sizeMax) { self->tail = 0; }
-	self->size++;
+/**
+ * @brief	Inserts elements
+ * @param	self			FixedQueue8*
+ * @param	elements		elements
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre availableSize >= count
+ */
+void FixedQueue8_pushN(FixedQueue8* const self, const uint8_t elements[], const size_t count)
+{
+	ASSERT_((self->sizeMax - fixed_queue8_size(self)) >= count);
+
+	const size_t tail = self->tail;
+	const size_t first = fixed_queue8_slot(self, tail);
+	const size_t firstCount = fixed_queue8_min_size(count, (self->sizeMax - first));
+
+	memcpy(&self->elements[first], &elements[0], firstCount);
+	memcpy(&self->elements[0], &elements[firstCount], (count - firstCount));
+	lib_barrier_release();
+	self->tail = fixed_queue8_advance_index(self, tail, count);
 }
 
 /**
@@ -147,10 +280,30 @@ void FixedQueue8_push(FixedQueue8* const self, const uint8_t element)
  */
 void FixedQueue8_pop(FixedQueue8* const self)
 {
-	ASSERT_(self->size > 0);
+	fixed_queue8_pop(self);
+}
+
+/**
+ * @brief	Removes elements into buffer
+ * @param	self			FixedQueue8*
+ * @param	elements		elements buffer
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre size >= count
+ */
+void FixedQueue8_popN(FixedQueue8* const self, uint8_t elements[], const size_t count)
+{
+	ASSERT_(fixed_queue8_size(self) >= count);
+
+	const size_t head = self->head;
+	const size_t first = fixed_queue8_slot(self, head);
+	const size_t firstCount = fixed_queue8_min_size(count, (self->sizeMax - first));
 
-	if (++self->head == self->sizeMax) { self->head = 0; }
-	self->size--;
+	memcpy(&elements[0], &self->elements[first], firstCount);
+	memcpy(&elements[firstCount], &self->elements[0], (count - firstCount));
+	lib_barrier_release();
+	self->head = fixed_queue8_advance_index(self, head, count);
 }
 
 /**
@@ -162,9 +315,63 @@ void FixedQueue8_pop(FixedQueue8* const self)
  */
 uint8_t FixedQueue8_front(const FixedQueue8* const self)
 {
-	ASSERT_(self->size > 0);
+	return fixed_queue8_front(self);
+}
 
-	return self->elements[self->head];
+/**
+ * @brief	Returns the contiguous readable elements
+ * @param	self			FixedQueue8*
+ * @param	span_size		pointer to the number of readable elements
+ * @return	a pointer to the next element
+ *
+ * @note Only the part up to the end of storage is returned. Call
+ *       FixedQueue8_commitRead() and then this again to get the part that
+ *       wrapped around.
+ */
+uint8_t* FixedQueue8_readableSpan(FixedQueue8* const self, size_t* const span_size)
+{
+	return fixed_queue8_readable_span(self, span_size);
+}
+
+/**
+ * @brief	Returns the contiguous writable elements
+ * @param	self			FixedQueue8*
+ * @param	span_size		pointer to the number of writable elements
+ * @return	a pointer to the next free element
+ *
+ * @note Only the part up to the end of storage is returned. Call
+ *       FixedQueue8_commitWrite() and then this again to get the part that
+ *       wrapped around.
+ */
+uint8_t* FixedQueue8_writableSpan(FixedQueue8* const self, size_t* const span_size)
+{
+	return fixed_queue8_writable_span(self, span_size);
+}
+
+/**
+ * @brief	Removes elements read through FixedQueue8_readableSpan()
+ * @param	self			FixedQueue8*
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by FixedQueue8_readableSpan()
+ */
+void FixedQueue8_commitRead(FixedQueue8* const self, const size_t count)
+{
+	fixed_queue8_commit_read(self, count);
+}
+
+/**
+ * @brief	Inserts elements written through FixedQueue8_writableSpan()
+ * @param	self			FixedQueue8*
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by FixedQueue8_writableSpan()
+ */
+void FixedQueue8_commitWrite(FixedQueue8* const self, const size_t count)
+{
+	fixed_queue8_commit_write(self, count);
 }
 
 /**
@@ -175,7 +382,7 @@ uint8_t FixedQueue8_front(const FixedQueue8* const self)
  */
 bool FixedQueue8_empty(const FixedQueue8* const self)
 {
-	return (self->size) ? false : true;
+	return fixed_queue8_empty(self);
 }
 
 /**
@@ -186,7 +393,7 @@ bool FixedQueue8_empty(const FixedQueue8* const self)
  */
 bool FixedQueue8_full(const FixedQueue8* const self)
 {
-	return (self->size < self->sizeMax) ? false : true;
+	return fixed_queue8_full(self);
 }
 
 /**
@@ -196,7 +403,7 @@ bool FixedQueue8_full(const FixedQueue8* const self)
  */
 size_t FixedQueue8_size(const FixedQueue8* const self)
 {
-	return self->size;
+	return fixed_queue8_size(self);
 }
 
 /**
@@ -206,7 +413,7 @@ size_t FixedQueue8_size(const FixedQueue8* const self)
  */
 size_t FixedQueue8_availableSize(const FixedQueue8* const self)
 {
-	return (self->sizeMax - self->size);
+	return fixed_queue8_available_size(self);
 }
 
 /**
@@ -24,19 +24,39 @@
 struct FixedQueue8;
 typedef struct FixedQueue8 FixedQueue8;
 
+struct Allocator;
+
+/*! @note Worst-case footprint of FixedQueue8_create() for the memory budget (see allocator_budget.h) */
+enum { kFIXED_QUEUE8_BUDGET_INSTANCE = ((2 * sizeof(void*)) + (4 * sizeof(size_t))) };
+#define FIXED_QUEUE8_BUDGET_(size_max) \
+	ALLOCATOR_BUDGET_BLOCK_(kFIXED_QUEUE8_BUDGET_INSTANCE + (size_max))
+
 size_t FixedQueue8_sizeOf(void);
+size_t FixedQueue8_blockSize(size_t size_max);
 
 FixedQueue8* FixedQueue8_create(size_t size_max);
+FixedQueue8* FixedQueue8_createFrom(struct Allocator* heap, size_t size_max);
+FixedQueue8* FixedQueue8_createAligned(struct Allocator* heap, size_t size_max, size_t alignment);
 FixedQueue8* FixedQueue8_destroy(FixedQueue8* self);
 
 int FixedQueue8_ctor(FixedQueue8* self, size_t size_max);
+int FixedQueue8_ctorFrom(FixedQueue8* self, struct Allocator* heap, size_t size_max);
+int FixedQueue8_ctorAligned(FixedQueue8* self, struct Allocator* heap, size_t size_max, size_t alignment);
+int FixedQueue8_ctorOn(FixedQueue8* self, uint8_t storage[], size_t size_max);
 void FixedQueue8_dtor(FixedQueue8* self);
 
 void FixedQueue8_clear(FixedQueue8* self);
 void FixedQueue8_push(FixedQueue8* self, uint8_t element);
+void FixedQueue8_pushN(FixedQueue8* self, const uint8_t elements[], size_t count);
 void FixedQueue8_pop(FixedQueue8* self);
+void FixedQueue8_popN(FixedQueue8* self, uint8_t elements[], size_t count);
 uint8_t FixedQueue8_front(const FixedQueue8* self);
 
+uint8_t* FixedQueue8_readableSpan(FixedQueue8* self, size_t* span_size);
+uint8_t* FixedQueue8_writableSpan(FixedQueue8* self, size_t* span_size);
+void FixedQueue8_commitRead(FixedQueue8* self, size_t count);
+void FixedQueue8_commitWrite(FixedQueue8* self, size_t count);
+
 bool FixedQueue8_empty(const FixedQueue8* self);
 bool FixedQueue8_full(const FixedQueue8* self);
 
@@ -44,4 +64,24 @@ size_t FixedQueue8_size(const FixedQueue8* self);
 size_t FixedQueue8_availableSize(const FixedQueue8* self);
 size_t FixedQueue8_maxSize(const FixedQueue8* self);
 
+/*!
+ * @note With USE_FIXED_QUEUE8_INLINE_, the per-element operations expand inline
+ *       (e.g. for ISR loops). The external functions above remain available.
+ */
+#if defined(USE_FIXED_QUEUE8_INLINE_) && !defined(SDPSES_CONTAINER_FIXED_QUEUE8_IMPLEMENTATION_)
+#include "fixed_queue8_inline.h"
+
+#define FixedQueue8_push(self, element)					fixed_queue8_push((self), (element))
+#define FixedQueue8_pop(self)							fixed_queue8_pop(self)
+#define FixedQueue8_front(self)							fixed_queue8_front(self)
+#define FixedQueue8_readableSpan(self, span_size)		fixed_queue8_readable_span((self), (span_size))
+#define FixedQueue8_writableSpan(self, span_size)		fixed_queue8_writable_span((self), (span_size))
+#define FixedQueue8_commitRead(self, count)				fixed_queue8_commit_read((self), (count))
+#define FixedQueue8_commitWrite(self, count)			fixed_queue8_commit_write((self), (count))
+#define FixedQueue8_empty(self)							fixed_queue8_empty(self)
+#define FixedQueue8_full(self)							fixed_queue8_full(self)
+#define FixedQueue8_size(self)							fixed_queue8_size(self)
+#define FixedQueue8_availableSize(self)					fixed_queue8_available_size(self)
+#endif /* USE_FIXED_QUEUE8_INLINE_ */
+
 #endif /* SDPSES_CONTAINER_FIXED_QUEUE8_H_INCLUDED_ */
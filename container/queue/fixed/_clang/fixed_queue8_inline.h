@@ -0,0 +1,141 @@
+/**
+ * @file	fixed_queue8_inline.h
+ * @brief	fixed-size queue8 inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_FIXED_QUEUE8_INLINE_H_INCLUDED_
+#define SDPSES_CONTAINER_FIXED_QUEUE8_INLINE_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib_assert.h"
+#include "lib_barrier.h"
+
+struct Allocator;
+
+/**
+ * @struct	FixedQueue8
+ * @brief	FixedQueue8 struct
+ * @note	Single-producer/single-consumer safe: push and pop may be called
+ *			from different contexts (e.g. ISR and main loop) without masking
+ *			interrupts, since only the producer writes tail and only the consumer
+ *			writes head.
+ * @note	The layout is public only for the inline operations below.
+ *			Don't access the members directly.
+ */
+struct FixedQueue8 {
+	struct Allocator* heap;	/*!< heap of the storage, or of the instance block if embedded (NULL: the default heap) */
+	size_t sizeMax;
+	size_t head;	/*!< written by the consumer only [0, 2 * sizeMax) */
+	size_t tail;	/*!< written by the producer only [0, 2 * sizeMax) */
+	uint8_t* elements;
+	bool embedded;	/*!< the storage is not released by the destructor (e.g. in the block of the instance) */
+};
+
+/*! @note Indexes run over twice the capacity so that full and empty differ. */
+static inline size_t fixed_queue8_next_index(const struct FixedQueue8* const self, const size_t index) {
+	return ((index + 1) == (self->sizeMax * 2)) ? 0 : (index + 1);
+}
+
+static inline size_t fixed_queue8_advance_index(const struct FixedQueue8* const self, const size_t index, const size_t count) {
+	const size_t advanced = index + count;
+	return (advanced < (self->sizeMax * 2)) ? advanced : (advanced - (self->sizeMax * 2));
+}
+
+static inline size_t fixed_queue8_min_size(const size_t a, const size_t b) {
+	return (a < b) ? a : b;
+}
+
+static inline size_t fixed_queue8_slot(const struct FixedQueue8* const self, const size_t index) {
+	return (index < self->sizeMax) ? index : (index - self->sizeMax);
+}
+
+static inline size_t fixed_queue8_size(const struct FixedQueue8* const self) {
+	const size_t head = self->head;
+	const size_t tail = self->tail;
+	lib_barrier_acquire();
+	return (tail >= head) ? (tail - head) : ((tail + (self->sizeMax * 2)) - head);
+}
+
+static inline size_t fixed_queue8_available_size(const struct FixedQueue8* const self) {
+	return (self->sizeMax - fixed_queue8_size(self));
+}
+
+static inline bool fixed_queue8_empty(const struct FixedQueue8* const self) {
+	return (fixed_queue8_size(self)) ? false : true;
+}
+
+static inline bool fixed_queue8_full(const struct FixedQueue8* const self) {
+	return (fixed_queue8_size(self) < self->sizeMax) ? false : true;
+}
+
+/*! @pre not full */
+static inline void fixed_queue8_push(struct FixedQueue8* const self, const uint8_t element) {
+	ASSERT_(fixed_queue8_size(self) < self->sizeMax);
+
+	const size_t tail = self->tail;
+	self->elements[fixed_queue8_slot(self, tail)] = element;
+	lib_barrier_release();
+	self->tail = fixed_queue8_next_index(self, tail);
+}
+
+/*! @pre not empty */
+static inline void fixed_queue8_pop(struct FixedQueue8* const self) {
+	ASSERT_(fixed_queue8_size(self) > 0);
+
+	const size_t head = self->head;
+	lib_barrier_release();
+	self->head = fixed_queue8_next_index(self, head);
+}
+
+/*! @pre not empty */
+static inline uint8_t fixed_queue8_front(const struct FixedQueue8* const self) {
+	ASSERT_(fixed_queue8_size(self) > 0);
+
+	return self->elements[fixed_queue8_slot(self, self->head)];
+}
+
+static inline uint8_t* fixed_queue8_readable_span(struct FixedQueue8* const self, size_t* const span_size) {
+	const size_t first = fixed_queue8_slot(self, self->head);
+	*span_size = fixed_queue8_min_size(fixed_queue8_size(self), (self->sizeMax - first));
+	return &self->elements[first];
+}
+
+static inline uint8_t* fixed_queue8_writable_span(struct FixedQueue8* const self, size_t* const span_size) {
+	const size_t first = fixed_queue8_slot(self, self->tail);
+	*span_size = fixed_queue8_min_size(fixed_queue8_available_size(self), (self->sizeMax - first));
+	return &self->elements[first];
+}
+
+/*! @pre count <= the size returned by fixed_queue8_readable_span() */
+static inline void fixed_queue8_commit_read(struct FixedQueue8* const self, const size_t count) {
+	ASSERT_(fixed_queue8_size(self) >= count);
+
+	const size_t head = self->head;
+	lib_barrier_release();
+	self->head = fixed_queue8_advance_index(self, head, count);
+}
+
+/*! @pre count <= the size returned by fixed_queue8_writable_span() */
+static inline void fixed_queue8_commit_write(struct FixedQueue8* const self, const size_t count) {
+	ASSERT_(fixed_queue8_available_size(self) >= count);
+
+	const size_t tail = self->tail;
+	lib_barrier_release();
+	self->tail = fixed_queue8_advance_index(self, tail, count);
+}
+
+#endif /* SDPSES_CONTAINER_FIXED_QUEUE8_INLINE_H_INCLUDED_ */
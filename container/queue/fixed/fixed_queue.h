@@ -19,28 +19,117 @@
 
 #include <cstddef>
 
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+struct Allocator;
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
+
+/*! @note Worst-case footprint of the FixedQueue<T> storage for the memory budget (see allocator_budget.h) */
+#define FIXED_QUEUE_BUDGET_(T, size_max)	ALLOCATOR_BUDGET_BLOCK_(sizeof(T) * (size_max))
+
 namespace sdpses {
 
 namespace container {
 
+/**
+ * @struct	FixedQueueStorage
+ * @brief	Inline storage of FixedQueue<T, N>
+ * @note	Raw storage: elements are constructed on push and destroyed on pop.
+ */
+template <typename T, std::size_t N>
+struct FixedQueueStorage {
+	FixedQueueStorage() {}
+	~FixedQueueStorage() {}
+
+	T* elements() { return reinterpret_cast<T*>(buffer_); }
+	const T* elements() const { return reinterpret_cast<const T*>(buffer_); }
+
+	static const std::size_t kSIZE_MAX = N;
+	static const bool kPOWER_OF_TWO = ((N & (N - 1)) == 0);
+
+#if (__cplusplus >= 201103L)
+	alignas(T) unsigned char buffer_[sizeof(T) * N];
+#else
+	unsigned char buffer_[sizeof(T) * N] __attribute__((aligned(__alignof__(T))));
+#endif
+};
+
+/**
+ * @struct	FixedQueueStorage
+ * @brief	Allocated storage of FixedQueue<T> (the capacity is given at run time)
+ * @note	Raw storage: elements are constructed on push and destroyed on pop.
+ */
+template <typename T>
+struct FixedQueueStorage<T, 0> {
+	explicit FixedQueueStorage(std::size_t size_max);
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	FixedQueueStorage(std::size_t size_max, ::Allocator* heap, std::size_t alignment);
+#endif
+	~FixedQueueStorage();
+
+	T* elements() { return elements_; }
+	const T* elements() const { return elements_; }
+
+	static const bool kPOWER_OF_TWO = false;
+
+	const std::size_t kSIZE_MAX;
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	::Allocator* const heap_;	/*!< NULL: the default heap */
+#endif
+	T* const elements_;
+
+private:
+	FixedQueueStorage(const FixedQueueStorage&);
+	FixedQueueStorage& operator=(const FixedQueueStorage&);
+
+	static std::size_t storageSize(std::size_t size_max, std::size_t alignment);
+};
+
 /**
  * @class	FixedQueue
  * @brief	Fixed-size Queue class
  * @note	Don't inherit from this class.
+ * @note	Single-producer/single-consumer safe: push() and pop() may be called
+ *			from different contexts (e.g. ISR and main loop) without masking
+ *			interrupts, since only the producer writes tail and only the consumer
+ *			writes head. clear() must not race with either side.
+ * @note	FixedQueue<T> takes its capacity at run time and allocates the storage
+ *			(from the given heap and e.g. cache-line aligned with USE_ORIGINAL_ALLOCATOR_).
+ *			Aligned storage is padded to a multiple of the alignment, so no
+ *			other data shares its cache lines.
+ *			FixedQueue<T, N> keeps N elements inline without allocation, and wraps
+ *			indexes by masking when N is a power of two.
+ * @note	Elements are constructed on push and destroyed on pop, so T needs
+ *			neither a default constructor nor an assignment operator for push/pop.
  */
-template <typename T>
+template <typename T, std::size_t N = 0>
 class FixedQueue {
 
 public:
-	explicit FixedQueue(std::size_t size_max);
+	FixedQueue();								/*!< FixedQueue<T, N> only */
+	explicit FixedQueue(std::size_t size_max);	/*!< FixedQueue<T> only */
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	FixedQueue(std::size_t size_max, ::Allocator* heap, std::size_t alignment = 0);	/*!< FixedQueue<T> only */
+#endif
 	~FixedQueue();
 
 	void clear();
 	void push(const T& element);
+	void push(const T elements[], std::size_t count);
+#if (__cplusplus >= 201103L)
+	void push(T&& element);
+	template <typename... Args>
+	void emplace(Args&&... args);
+#endif
 	void pop();
+	void pop(T elements[], std::size_t count);
 	T& front();
 	const T& front() const;
 
+	T* readableSpan(std::size_t* span_size);
+	T* writableSpan(std::size_t* span_size);
+	void commitRead(std::size_t count);
+	void commitWrite(std::size_t count);
+
 	bool empty() const;
 	bool full() const;
 
@@ -49,16 +138,20 @@ public:
 	std::size_t maxSize() const;
 
 private:
-	FixedQueue();
 	FixedQueue(const FixedQueue&);
 	FixedQueue& operator=(const FixedQueue&);
 
-	const std::size_t kSIZE_MAX;
+	std::size_t nextIndex(std::size_t index) const;
+	std::size_t advanceIndex(std::size_t index, std::size_t count) const;
+	std::size_t slot(std::size_t index) const;
+	std::size_t distance(std::size_t head, std::size_t tail) const;
+	static void destroy(T* first, T* last);
 
-	std::size_t head_;
-	std::size_t tail_;
-	std::size_t size_;
-	T* const elements_;
+	typedef FixedQueueStorage<T, N> Storage;
+
+	std::size_t head_;	/*!< written by the consumer only [0, 2 * maxSize()) */
+	std::size_t tail_;	/*!< written by the producer only [0, 2 * maxSize()) */
+	Storage storage_;
 };
 
 } /* namespace container */
@@ -20,54 +20,156 @@
 #include "allocator.h"
 #endif /* USE_ORIGINAL_ALLOCATOR_ */
 
+#include <algorithm>
+#include <memory>
+#include <new>
+#if (__cplusplus >= 201103L)
+#include <utility>
+#endif
+
+#include "lib_barrier.h"
+
 namespace sdpses {
 
 namespace container {
 
+template <typename T, std::size_t N>
+const std::size_t FixedQueueStorage<T, N>::kSIZE_MAX;
+
+template <typename T, std::size_t N>
+const bool FixedQueueStorage<T, N>::kPOWER_OF_TWO;
+
+template <typename T>
+const bool FixedQueueStorage<T, 0>::kPOWER_OF_TWO;
+
 /**
  * @brief	Constructor
  * @param	size_max		the maximum number of elements
  */
 template <typename T>
-inline FixedQueue<T>::FixedQueue(const std::size_t size_max)
+inline FixedQueueStorage<T, 0>::FixedQueueStorage(const std::size_t size_max)
 	: kSIZE_MAX(size_max)
-	, head_(0)
-	, tail_(0)
-	, size_(0)
 #if defined(USE_ORIGINAL_ALLOCATOR_)
-	, elements_(new(Allocator_allocate((sizeof(T) * size_max) + sizeof(std::size_t))) T[size_max])
+	, heap_(NULL)
+	, elements_(static_cast<T*>(Allocator_allocate(sizeof(T) * size_max)))
 #else
-	, elements_(new T[size_max])
+	, elements_(static_cast<T*>(::operator new(sizeof(T) * size_max)))
 #endif
 {
 }
 
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+/**
+ * @brief	Constructor
+ * @param	size_max		the maximum number of elements
+ * @param	heap			heap of the storage (NULL: the default heap)
+ * @param	alignment		alignment of the storage (power of two, 0: the default alignment)
+ */
+template <typename T>
+inline FixedQueueStorage<T, 0>::FixedQueueStorage(const std::size_t size_max, ::Allocator* const heap, const std::size_t alignment)
+	: kSIZE_MAX(size_max)
+	, heap_(heap)
+	, elements_(static_cast<T*>(Allocator_allocateAlignedFrom(heap, storageSize(size_max, alignment), alignment)))
+{
+}
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
+
+/**
+ * @brief	Returns the size of the storage
+ * @param	size_max		the maximum number of elements
+ * @param	alignment		alignment of the storage (power of two, 0: the default alignment)
+ * @return	the size padded to a multiple of the alignment
+ * @note	The range can be flushed or invalidated without touching other data.
+ */
+template <typename T>
+inline std::size_t FixedQueueStorage<T, 0>::storageSize(const std::size_t size_max, const std::size_t alignment)
+{
+	const std::size_t size = sizeof(T) * size_max;
+	return (alignment) ? ((size + (alignment - 1)) & ~(alignment - 1)) : size;
+}
+
 /**
  * @brief	Destructor
  */
 template <typename T>
-inline FixedQueue<T>::~FixedQueue()
+inline FixedQueueStorage<T, 0>::~FixedQueueStorage()
 {
 #if defined(USE_ORIGINAL_ALLOCATOR_)
-	for (std::size_t i = 0; i < kSIZE_MAX; i++) {
-		elements_[i].~T();
-	}
-	Allocator_deallocate(elements_);
+	Allocator_deallocateFrom(heap_, elements_);
 #else
-	delete[] elements_;
+	::operator delete(elements_);
 #endif
 }
 
+/**
+ * @brief	Constructor (FixedQueue<T, N>)
+ */
+template <typename T, std::size_t N>
+inline FixedQueue<T, N>::FixedQueue()
+	: head_(0)
+	, tail_(0)
+	, storage_()
+{
+}
+
+/**
+ * @brief	Constructor (FixedQueue<T>)
+ * @param	size_max		the maximum number of elements
+ */
+template <typename T, std::size_t N>
+inline FixedQueue<T, N>::FixedQueue(const std::size_t size_max)
+	: head_(0)
+	, tail_(0)
+	, storage_(size_max)
+{
+}
+
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+/**
+ * @brief	Constructor (FixedQueue<T>)
+ * @param	size_max		the maximum number of elements
+ * @param	heap			heap of the storage (NULL: the default heap)
+ * @param	alignment		alignment of the storage (power of two, 0: the default alignment)
+ *
+ * @note e.g. kALLOCATOR_CACHE_LINE_SIZE for storage flushed or invalidated by range (DMA).
+ */
+template <typename T, std::size_t N>
+inline FixedQueue<T, N>::FixedQueue(const std::size_t size_max, ::Allocator* const heap, const std::size_t alignment)
+	: head_(0)
+	, tail_(0)
+	, storage_(size_max, heap, alignment)
+{
+}
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
+
+/**
+ * @brief	Destructor
+ */
+template <typename T, std::size_t N>
+inline FixedQueue<T, N>::~FixedQueue()
+{
+	clear();
+}
+
 /**
  * @brief	Removes all elements
  * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
  */
-template <typename T>
-inline void FixedQueue<T>::clear()
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::clear()
 {
+	const std::size_t count = size();
+	const std::size_t first = slot(head_);
+	const std::size_t firstCount = std::min(count, (storage_.kSIZE_MAX - first));
+
+	destroy(&storage_.elements()[first], &storage_.elements()[first + firstCount]);
+	destroy(&storage_.elements()[0], &storage_.elements()[count - firstCount]);
+
 	head_ = 0;
 	tail_ = 0;
-	size_ = 0;
+	lib_barrier_release();
 }
 
 /**
@@ -77,12 +179,72 @@ inline void FixedQueue<T>::clear()
  *
  * @pre not full
  */
-template <typename T>
-inline void FixedQueue<T>::push(const T& element)
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::push(const T& element)
+{
+	const std::size_t tail = tail_;
+
+	new(&storage_.elements()[slot(tail)]) T(element);
+	lib_barrier_release();
+	tail_ = nextIndex(tail);
+}
+
+#if (__cplusplus >= 201103L)
+/**
+ * @brief	Inserts a element by moving it
+ * @param	element			element
+ * @return	none
+ *
+ * @pre not full
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::push(T&& element)
+{
+	const std::size_t tail = tail_;
+
+	new(&storage_.elements()[slot(tail)]) T(std::move(element));
+	lib_barrier_release();
+	tail_ = nextIndex(tail);
+}
+
+/**
+ * @brief	Constructs a element in place
+ * @param	args			constructor arguments
+ * @return	none
+ *
+ * @pre not full
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+inline void FixedQueue<T, N>::emplace(Args&&... args)
+{
+	const std::size_t tail = tail_;
+
+	new(&storage_.elements()[slot(tail)]) T(std::forward<Args>(args)...);
+	lib_barrier_release();
+	tail_ = nextIndex(tail);
+}
+#endif
+
+/**
+ * @brief	Inserts elements
+ * @param	elements		elements
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre availableSize() >= count
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::push(const T elements[], const std::size_t count)
 {
-	elements_[tail_] = element;
-	if (++tail_ == kSIZE_MAX) { tail_ = 0; }
-	size_++;
+	const std::size_t tail = tail_;
+	const std::size_t first = slot(tail);
+	const std::size_t firstCount = std::min(count, (storage_.kSIZE_MAX - first));
+
+	std::uninitialized_copy(&elements[0], &elements[firstCount], &storage_.elements()[first]);
+	std::uninitialized_copy(&elements[firstCount], &elements[count], &storage_.elements()[0]);
+	lib_barrier_release();
+	tail_ = advanceIndex(tail, count);
 }
 
 /**
@@ -91,11 +253,37 @@ inline void FixedQueue<T>::push(const T& element)
  *
  * @pre not empty
  */
-template <typename T>
-inline void FixedQueue<T>::pop()
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::pop()
 {
-	if (++head_ == kSIZE_MAX) { head_ = 0; }
-	size_--;
+	const std::size_t head = head_;
+
+	storage_.elements()[slot(head)].~T();
+	lib_barrier_release();
+	head_ = nextIndex(head);
+}
+
+/**
+ * @brief	Removes elements into buffer
+ * @param	elements		elements buffer
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre size() >= count
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::pop(T elements[], const std::size_t count)
+{
+	const std::size_t head = head_;
+	const std::size_t first = slot(head);
+	const std::size_t firstCount = std::min(count, (storage_.kSIZE_MAX - first));
+
+	std::copy(&storage_.elements()[first], &storage_.elements()[first + firstCount], &elements[0]);
+	std::copy(&storage_.elements()[0], &storage_.elements()[count - firstCount], &elements[firstCount]);
+	destroy(&storage_.elements()[first], &storage_.elements()[first + firstCount]);
+	destroy(&storage_.elements()[0], &storage_.elements()[count - firstCount]);
+	lib_barrier_release();
+	head_ = advanceIndex(head, count);
 }
 
 /**
@@ -104,16 +292,84 @@ inline void FixedQueue<T>::pop()
  *
  * @pre not empty
  */
-template <typename T>
-inline T& FixedQueue<T>::front()
+template <typename T, std::size_t N>
+inline T& FixedQueue<T, N>::front()
 {
-	return elements_[head_];
+	return storage_.elements()[slot(head_)];
 }
 
-template <typename T>
-inline const T& FixedQueue<T>::front() const
+template <typename T, std::size_t N>
+inline const T& FixedQueue<T, N>::front() const
+{
+	return storage_.elements()[slot(head_)];
+}
+
+/**
+ * @brief	Returns the contiguous readable elements
+ * @param	span_size		pointer to the number of readable elements
+ * @return	a pointer to the next element
+ *
+ * @note Only the part up to the end of storage is returned. Call commitRead()
+ *       and then this again to get the part that wrapped around.
+ */
+template <typename T, std::size_t N>
+inline T* FixedQueue<T, N>::readableSpan(std::size_t* const span_size)
+{
+	const std::size_t first = slot(head_);
+	*span_size = std::min(size(), (storage_.kSIZE_MAX - first));
+	return &storage_.elements()[first];
+}
+
+/**
+ * @brief	Returns the contiguous writable elements
+ * @param	span_size		pointer to the number of writable elements
+ * @return	a pointer to the next free element
+ *
+ * @note Only the part up to the end of storage is returned. Call commitWrite()
+ *       and then this again to get the part that wrapped around.
+ */
+template <typename T, std::size_t N>
+inline T* FixedQueue<T, N>::writableSpan(std::size_t* const span_size)
+{
+	const std::size_t first = slot(tail_);
+	*span_size = std::min(availableSize(), (storage_.kSIZE_MAX - first));
+	return &storage_.elements()[first];
+}
+
+/**
+ * @brief	Removes elements read through readableSpan()
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by readableSpan()
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::commitRead(const std::size_t count)
+{
+	const std::size_t head = head_;
+	const std::size_t first = slot(head);
+
+	destroy(&storage_.elements()[first], &storage_.elements()[first + count]);
+	lib_barrier_release();
+	head_ = advanceIndex(head, count);
+}
+
+/**
+ * @brief	Inserts elements written through writableSpan()
+ * @param	count			number of elements
+ * @return	none
+ *
+ * @pre count <= the size returned by writableSpan()
+ * @pre the elements have been constructed (e.g. by placement new).
+ *      Trivially copyable elements may simply be assigned.
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::commitWrite(const std::size_t count)
 {
-	return elements_[head_];
+	const std::size_t tail = tail_;
+
+	lib_barrier_release();
+	tail_ = advanceIndex(tail, count);
 }
 
 /**
@@ -121,10 +377,10 @@ inline const T& FixedQueue<T>::front() const
  * @retval	true			empty
  * @retval	false			not empty
  */
-template <typename T>
-inline bool FixedQueue<T>::empty() const
+template <typename T, std::size_t N>
+inline bool FixedQueue<T, N>::empty() const
 {
-	return (size_) ? false : true;
+	return (size()) ? false : true;
 }
 
 /**
@@ -132,40 +388,110 @@ inline bool FixedQueue<T>::empty() const
  * @retval	true			full
  * @retval	false			not full
  */
-template <typename T>
-inline bool FixedQueue<T>::full() const
+template <typename T, std::size_t N>
+inline bool FixedQueue<T, N>::full() const
 {
-	return (size_ < kSIZE_MAX) ? false : true;
+	return (size() < storage_.kSIZE_MAX) ? false : true;
 }
 
 /**
  * @brief	Returns the number of elements
  * @return	the number of elements
  */
-template <typename T>
-inline std::size_t FixedQueue<T>::size() const
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::size() const
 {
-	return size_;
+	const std::size_t size = distance(head_, tail_);
+	lib_barrier_acquire();
+	return size;
 }
 
 /**
  * @brief	Returns the number of storable elements
  * @return	the number of storable elements
  */
-template <typename T>
-inline std::size_t FixedQueue<T>::availableSize() const
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::availableSize() const
 {
-	return (kSIZE_MAX - size_);
+	return (storage_.kSIZE_MAX - size());
 }
 
 /**
  * @brief	Returns the maximum number of elements
  * @return	the maximum number of elements
  */
-template <typename T>
-inline std::size_t FixedQueue<T>::maxSize() const
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::maxSize() const
+{
+	return storage_.kSIZE_MAX;
+}
+
+/**
+ * @brief	Returns the index following the given index
+ * @param	index			index [0, 2 * maxSize())
+ * @return	next index
+ *
+ * @note Indexes run over twice the capacity so that full and empty differ.
+ *       A power-of-two capacity wraps them by masking.
+ */
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::nextIndex(const std::size_t index) const
 {
-	return kSIZE_MAX;
+	if (Storage::kPOWER_OF_TWO) { return ((index + 1) & ((storage_.kSIZE_MAX * 2) - 1)); }
+	return ((index + 1) == (storage_.kSIZE_MAX * 2)) ? 0 : (index + 1);
+}
+
+/**
+ * @brief	Returns the index advanced by the given count
+ * @param	index			index [0, 2 * maxSize())
+ * @param	count			count [0, maxSize()]
+ * @return	advanced index
+ */
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::advanceIndex(const std::size_t index, const std::size_t count) const
+{
+	const std::size_t advanced = index + count;
+	if (Storage::kPOWER_OF_TWO) { return (advanced & ((storage_.kSIZE_MAX * 2) - 1)); }
+	return (advanced < (storage_.kSIZE_MAX * 2)) ? advanced : (advanced - (storage_.kSIZE_MAX * 2));
+}
+
+/**
+ * @brief	Returns the storage slot of the index
+ * @param	index			index [0, 2 * maxSize())
+ * @return	slot [0, maxSize())
+ */
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::slot(const std::size_t index) const
+{
+	if (Storage::kPOWER_OF_TWO) { return (index & (storage_.kSIZE_MAX - 1)); }
+	return (index < storage_.kSIZE_MAX) ? index : (index - storage_.kSIZE_MAX);
+}
+
+/**
+ * @brief	Returns the number of elements between indexes
+ * @param	head			head index
+ * @param	tail			tail index
+ * @return	the number of elements
+ */
+template <typename T, std::size_t N>
+inline std::size_t FixedQueue<T, N>::distance(const std::size_t head, const std::size_t tail) const
+{
+	if (Storage::kPOWER_OF_TWO) { return ((tail - head) & ((storage_.kSIZE_MAX * 2) - 1)); }
+	return (tail >= head) ? (tail - head) : ((tail + (storage_.kSIZE_MAX * 2)) - head);
+}
+
+/**
+ * @brief	Destroys elements in the range
+ * @param	first			first element
+ * @param	last			past the last element
+ * @return	none
+ */
+template <typename T, std::size_t N>
+inline void FixedQueue<T, N>::destroy(T* first, T* const last)
+{
+	for (; first != last; ++first) {
+		first->~T();
+	}
 }
 
 } /* namespace container */
@@ -0,0 +1,239 @@
+/**
+ * @file	ring_buffer8.c
+ * @brief	overwrite-oldest ring buffer8
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include "allocator.h"
+
+#include "ring_buffer8.h"
+#include "lib_barrier.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	RingBuffer8
+ * @brief	RingBuffer8 struct
+ * @note	Push never fails: when the buffer is full the oldest element is
+ *			overwritten. The consumer counts the overwritten elements as lost.
+ * @note	Single-producer/single-consumer safe: push may be called from an ISR
+ *			while the main loop pops. The producer only writes the written
+ *			counter, and pop discards an element overwritten while copying it.
+ * @note	The latest buffSize - 1 elements are kept, since the slot being
+ *			written by the producer cannot be read.
+ */
+struct RingBuffer8 {
+	size_t buffSize;	/*!< power of two */
+	size_t written;		/*!< written by the producer only (free-running) */
+	size_t read;		/*!< written by the consumer only (free-running) */
+	size_t lost;		/*!< written by the consumer only */
+	uint8_t* elements;
+};
+
+static inline size_t size_max(const RingBuffer8* const self) {
+	return (self->buffSize - 1);
+}
+
+/**
+ * @brief	Get the size of RingBuffer8
+ * @return	the size of RingBuffer8
+ */
+size_t RingBuffer8_sizeOf(void)
+{
+	return sizeof(RingBuffer8);
+}
+
+/**
+ * @brief	Create
+ * @param	buff_size		buffer size (power of two, keeps buff_size - 1 elements)
+ * @return	instance
+ */
+RingBuffer8* RingBuffer8_create(const size_t buff_size)
+{
+	RingBuffer8* const instance = Allocator_allocate(sizeof(RingBuffer8));
+	if (!instance) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (RingBuffer8_ctor(instance, buff_size)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			RingBuffer8*
+ * @return	RingBuffer8*
+ */
+RingBuffer8* RingBuffer8_destroy(RingBuffer8* const self)
+{
+	if (!self) { return NULL; }
+
+	RingBuffer8_dtor(self);
+	Allocator_deallocate(self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	self			RingBuffer8*
+ * @param	buff_size		buffer size (power of two, keeps buff_size - 1 elements)
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int RingBuffer8_ctor(RingBuffer8* const self, const size_t buff_size)
+{
+	if ((buff_size < 2) || (buff_size & (buff_size - 1))) {
+		DEBUG_PRINTF_("buff_size must be a power of two\r\n");
+		return 1;
+	}
+
+	self->buffSize = buff_size;
+	self->elements = Allocator_allocate(sizeof(uint8_t) * buff_size);
+	if (!self->elements) {
+		FATAL_("Cannot allocate memory\r\n");
+		return 1;
+	}
+
+	RingBuffer8_clear(self);
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	self			RingBuffer8*
+ * @return	none
+ */
+void RingBuffer8_dtor(RingBuffer8* const self)
+{
+	if (!self) { return; }
+
+	Allocator_deallocate(self->elements);
+}
+
+/**
+ * @brief	Removes all elements and clears the lost count
+ * @param	self			RingBuffer8*
+ * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
+ */
+void RingBuffer8_clear(RingBuffer8* const self)
+{
+	self->written = 0;
+	self->read = 0;
+	self->lost = 0;
+	lib_barrier_release();
+}
+
+/**
+ * @brief	Inserts a element, overwriting the oldest one when full
+ * @param	self			RingBuffer8*
+ * @param	element			element
+ * @return	none
+ */
+void RingBuffer8_push(RingBuffer8* const self, const uint8_t element)
+{
+	const size_t written = self->written;
+
+	self->elements[written & (self->buffSize - 1)] = element;
+	lib_barrier_release();
+	self->written = written + 1;
+}
+
+/**
+ * @brief	Removes the oldest element
+ * @param	self			RingBuffer8*
+ * @param	element			pointer to the removed element
+ * @retval	true			success
+ * @retval	false			empty
+ */
+bool RingBuffer8_pop(RingBuffer8* const self, uint8_t* const element)
+{
+	for (;;) {
+		const size_t written = self->written;
+		lib_barrier_acquire();
+
+		size_t read = self->read;
+		if ((written - read) > size_max(self)) {
+			self->lost += (written - read) - size_max(self);
+			read = written - size_max(self);
+		}
+
+		if (read == written) {
+			self->read = read;
+			return false;
+		}
+
+		*element = self->elements[read & (self->buffSize - 1)];
+		lib_barrier_acquire();
+
+		/* The copy is valid unless the producer has reached the slot meanwhile. */
+		if ((self->written - read) < self->buffSize) {
+			self->read = read + 1;
+			return true;
+		}
+
+		self->read = read;
+	}
+}
+
+/**
+ * @brief	Is empty
+ * @param	self			RingBuffer8*
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+bool RingBuffer8_empty(const RingBuffer8* const self)
+{
+	return (RingBuffer8_size(self)) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of elements
+ * @param	self			RingBuffer8*
+ * @return	the number of elements
+ */
+size_t RingBuffer8_size(const RingBuffer8* const self)
+{
+	const size_t count = self->written - self->read;
+	lib_barrier_acquire();
+	return (count < size_max(self)) ? count : size_max(self);
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @param	self			RingBuffer8*
+ * @return	the maximum number of elements (buffer size - 1)
+ */
+size_t RingBuffer8_maxSize(const RingBuffer8* const self)
+{
+	return size_max(self);
+}
+
+/**
+ * @brief	Returns the number of overwritten elements
+ * @param	self			RingBuffer8*
+ * @return	the number of elements lost since RingBuffer8_clear()
+ */
+size_t RingBuffer8_lostCount(const RingBuffer8* const self)
+{
+	const size_t count = self->written - self->read;
+	lib_barrier_acquire();
+	return (count > size_max(self)) ? (self->lost + (count - size_max(self))) : self->lost;
+}
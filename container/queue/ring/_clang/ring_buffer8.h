@@ -0,0 +1,45 @@
+/**
+ * @file	ring_buffer8.h
+ * @brief	overwrite-oldest ring buffer8
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_RING_BUFFER8_H_INCLUDED_
+#define SDPSES_CONTAINER_RING_BUFFER8_H_INCLUDED_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct RingBuffer8;
+typedef struct RingBuffer8 RingBuffer8;
+
+size_t RingBuffer8_sizeOf(void);
+
+RingBuffer8* RingBuffer8_create(size_t buff_size);
+RingBuffer8* RingBuffer8_destroy(RingBuffer8* self);
+
+int RingBuffer8_ctor(RingBuffer8* self, size_t buff_size);
+void RingBuffer8_dtor(RingBuffer8* self);
+
+void RingBuffer8_clear(RingBuffer8* self);
+void RingBuffer8_push(RingBuffer8* self, uint8_t element);
+bool RingBuffer8_pop(RingBuffer8* self, uint8_t* element);
+
+bool RingBuffer8_empty(const RingBuffer8* self);
+
+size_t RingBuffer8_size(const RingBuffer8* self);
+size_t RingBuffer8_maxSize(const RingBuffer8* self);
+size_t RingBuffer8_lostCount(const RingBuffer8* self);
+
+#endif /* SDPSES_CONTAINER_RING_BUFFER8_H_INCLUDED_ */
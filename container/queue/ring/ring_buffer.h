@@ -0,0 +1,77 @@
+/**
+ * @file	ring_buffer.h
+ * @brief	overwrite-oldest ring buffer
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_CONTAINER_RING_BUFFER_H_INCLUDED_
+#define SDPSES_CONTAINER_RING_BUFFER_H_INCLUDED_
+
+#include <cstddef>
+
+namespace sdpses {
+
+namespace container {
+
+/**
+ * @class	RingBuffer
+ * @brief	Ring Buffer class (overwrites the oldest elements)
+ * @note	Don't inherit from this class.
+ * @note	push() never fails: when the buffer is full the oldest element is
+ *			overwritten. The consumer counts the overwritten elements as lost.
+ * @note	Single-producer/single-consumer safe: push() may be called from an
+ *			ISR while the main loop pops. The producer only writes the written
+ *			counter, and pop() discards an element overwritten while copying it.
+ * @note	N must be a power of two. The latest N - 1 elements are kept, since
+ *			the slot being written by the producer cannot be read.
+ * @note	T should be trivially copyable (e.g. a trace record struct).
+ */
+template <typename T, std::size_t N>
+class RingBuffer {
+
+public:
+	RingBuffer();
+	~RingBuffer();
+
+	void clear();
+	void push(const T& element);
+	bool pop(T* element);
+
+	bool empty() const;
+
+	std::size_t size() const;
+	std::size_t maxSize() const;
+	std::size_t lostCount() const;
+
+private:
+	RingBuffer(const RingBuffer&);
+	RingBuffer& operator=(const RingBuffer&);
+
+	/*! @note Compile error unless N is a power of two greater than 1. */
+	typedef char PowerOfTwoCheck[((N > 1) && ((N & (N - 1)) == 0)) ? 1 : -1];
+
+	static const std::size_t kSIZE_MAX = N - 1;
+
+	std::size_t written_;	/*!< written by the producer only (free-running) */
+	std::size_t read_;		/*!< written by the consumer only (free-running) */
+	std::size_t lost_;		/*!< written by the consumer only */
+	T elements_[N];
+};
+
+} /* namespace container */
+
+} /* namespace sdpses */
+
+#include "ring_buffer_inline.h"
+
+#endif /* SDPSES_CONTAINER_RING_BUFFER_H_INCLUDED_ */
@@ -0,0 +1,162 @@
+/**
+ * @file	ring_buffer_inline.h
+ * @brief	overwrite-oldest ring buffer inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#include "lib_barrier.h"
+
+namespace sdpses {
+
+namespace container {
+
+template <typename T, std::size_t N>
+const std::size_t RingBuffer<T, N>::kSIZE_MAX;
+
+/**
+ * @brief	Constructor
+ */
+template <typename T, std::size_t N>
+inline RingBuffer<T, N>::RingBuffer()
+	: written_(0)
+	, read_(0)
+	, lost_(0)
+	, elements_()
+{
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename T, std::size_t N>
+inline RingBuffer<T, N>::~RingBuffer()
+{
+}
+
+/**
+ * @brief	Removes all elements and clears the lost count
+ * @return	none
+ *
+ * @attention Neither the producer nor the consumer may run concurrently.
+ */
+template <typename T, std::size_t N>
+inline void RingBuffer<T, N>::clear()
+{
+	written_ = 0;
+	read_ = 0;
+	lost_ = 0;
+	lib_barrier_release();
+}
+
+/**
+ * @brief	Inserts a element, overwriting the oldest one when full
+ * @param	element			element
+ * @return	none
+ */
+template <typename T, std::size_t N>
+inline void RingBuffer<T, N>::push(const T& element)
+{
+	const std::size_t written = written_;
+
+	elements_[written & (N - 1)] = element;
+	lib_barrier_release();
+	written_ = written + 1;
+}
+
+/**
+ * @brief	Removes the oldest element
+ * @param	element			pointer to the removed element
+ * @retval	true			success
+ * @retval	false			empty
+ */
+template <typename T, std::size_t N>
+inline bool RingBuffer<T, N>::pop(T* const element)
+{
+	for (;;) {
+		const std::size_t written = written_;
+		lib_barrier_acquire();
+
+		std::size_t read = read_;
+		if ((written - read) > kSIZE_MAX) {
+			lost_ += (written - read) - kSIZE_MAX;
+			read = written - kSIZE_MAX;
+		}
+
+		if (read == written) {
+			read_ = read;
+			return false;
+		}
+
+		*element = elements_[read & (N - 1)];
+		lib_barrier_acquire();
+
+		/* The copy is valid unless the producer has reached the slot meanwhile. */
+		if ((written_ - read) < N) {
+			read_ = read + 1;
+			return true;
+		}
+
+		read_ = read;
+	}
+}
+
+/**
+ * @brief	Is empty
+ * @retval	true			empty
+ * @retval	false			not empty
+ */
+template <typename T, std::size_t N>
+inline bool RingBuffer<T, N>::empty() const
+{
+	return (size()) ? false : true;
+}
+
+/**
+ * @brief	Returns the number of elements
+ * @return	the number of elements
+ */
+template <typename T, std::size_t N>
+inline std::size_t RingBuffer<T, N>::size() const
+{
+	const std::size_t count = written_ - read_;
+	lib_barrier_acquire();
+	return (count < kSIZE_MAX) ? count : kSIZE_MAX;
+}
+
+/**
+ * @brief	Returns the maximum number of elements
+ * @return	the maximum number of elements (N - 1)
+ */
+template <typename T, std::size_t N>
+inline std::size_t RingBuffer<T, N>::maxSize() const
+{
+	return kSIZE_MAX;
+}
+
+/**
+ * @brief	Returns the number of overwritten elements
+ * @return	the number of elements lost since clear()
+ */
+template <typename T, std::size_t N>
+inline std::size_t RingBuffer<T, N>::lostCount() const
+{
+	const std::size_t count = written_ - read_;
+	lib_barrier_acquire();
+	return (count > kSIZE_MAX) ? (lost_ + (count - kSIZE_MAX)) : lost_;
+}
+
+} /* namespace container */
+
+} /* namespace sdpses */
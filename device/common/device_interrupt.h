@@ -64,12 +64,15 @@ static inline void device_interrupt_disable(const uint32_t intc, const uint32_t
 static inline void device_interrupt_clear(const uint32_t intc, const uint32_t irq) {
 	XIntc_AckIntr(intc, (1UL << irq));
 }
+/*! @note The context keeps MSR[IE] so that nested disable/enable pairs (e.g. in an ISR) stay disabled. */
 static inline interrupt_context_t device_interrupt_disable_all(void) {
+	uint32_t msr;
+	__asm__ __volatile__ ("mfs %0, rmsr" : "=r" (msr));
 	microblaze_disable_interrupts();
-	return 0;
+	return (interrupt_context_t)(msr & 0x2UL);
 }
 static inline void device_interrupt_enable_all(const interrupt_context_t context) {
-	microblaze_enable_interrupts();
+	if (context) { microblaze_enable_interrupts(); }
 }
 
 /*--- Unknown Processor Type -------------------------------------------------*/
@@ -0,0 +1,248 @@
+/**
+ * @file	cclock_timer.c
+ * @brief	host clock timer/counter (for the free run counter on a host build)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdbool.h>
+#include <time.h>
+
+#include "allocator.h"
+
+#include "timer_private.h"
+#include "cclock_timer.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	CclockTimer
+ * @brief	CclockTimer struct
+ * @extends	Timer
+ * @note	Emulates a 32-bit counter at kFREQ with the monotonic clock
+ *			(clock() where it is not available). No interrupts.
+ */
+struct CclockTimer {
+	struct Timer timer; /*!< must be the first member for mutual conversion of pointers */
+
+	TimerCountMethod method;
+	uint32_t loadCountValue;
+
+	uint32_t startTicks;	/*!< host ticks at start */
+	uint32_t stopCount;		/*!< counter value while stopped */
+	bool running;
+};
+
+#if defined(CLOCK_MONOTONIC)
+static const uint32_t kFREQ = 1000000000UL;	/*!< [Hz] 1 count = 1 ns */
+#else
+static const uint32_t kFREQ = (uint32_t)CLOCKS_PER_SEC;
+#endif
+
+static void assignVirtualFunctions(struct CclockTimer* instance);
+
+/*! @note Host ticks at kFREQ, wrapping like a 32-bit counter. */
+static inline uint32_t host_ticks(void) {
+#if defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+#else
+	return (uint32_t)clock();
+#endif
+}
+
+static inline uint32_t count_of_elapsed(const struct CclockTimer* const instance, const uint32_t elapsed) {
+	return (instance->method == kTIMER_COUNT_METHOD_UP) ?
+			elapsed : (uint32_t)(instance->loadCountValue - elapsed);
+}
+
+/**
+ * @brief	Get the size of CclockTimer
+ * @return	the size of CclockTimer
+ */
+size_t CclockTimer_sizeOf(void)
+{
+	return sizeof(struct CclockTimer);
+}
+
+/**
+ * @brief	Create
+ * @return	instance
+ */
+struct CclockTimer* CclockTimer_create(void)
+{
+	struct CclockTimer* const instance = Allocator_allocate(sizeof(struct CclockTimer));
+	if (!instance) {
+		DEBUG_PRINTF_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	if (CclockTimer_ctor(instance)) {
+		Allocator_deallocate(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			Timer*
+ * @return	Timer*
+ */
+struct Timer* CclockTimer_destroy(struct Timer* const self)
+{
+	if (!self) { return NULL; }
+
+	struct CclockTimer* const instance = (struct CclockTimer*)self;
+	CclockTimer_dtor(instance);
+	Allocator_deallocate(instance);
+
+	return NULL;
+}
+
+/**
+ * @brief	Constructor
+ * @param	instance		instance
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int CclockTimer_ctor(struct CclockTimer* const instance)
+{
+	if (Timer_ctor((struct Timer*)instance)) { return 1; }
+
+	assignVirtualFunctions(instance);
+
+	const TimerCountParams params = {
+		kTIMER_COUNT_METHOD_DEFAULT,
+		kTIMER_RELOAD_DEFAULT,
+		kLOAD_COUNT_VALUE_DEFAULT
+	};
+	if (CclockTimer_setup((struct Timer*)instance, &params)) { return 1; }
+
+	return 0;
+}
+
+/**
+ * @brief	Destructor
+ * @param	instance		instance
+ * @return	none
+ */
+void CclockTimer_dtor(struct CclockTimer* const instance)
+{
+	if (!instance) { return; }
+
+	Timer_dtor((struct Timer*)instance);
+}
+
+/**
+ * @brief	Set up
+ * @param	self			Timer*
+ * @param	params			TimerCountParams
+ * @retval	0				success
+ * @retval	!=0				failure
+ *
+ * @note Only the free-running use is supported: reload at 0xFFFFFFFF.
+ */
+int CclockTimer_setup(struct Timer* const self, const TimerCountParams* const params)
+{
+	struct CclockTimer* const instance = (struct CclockTimer*)self;
+
+	if ((params->reload == kTIMER_RELOAD_DISABLE) || (params->loadCountValue != 0xFFFFFFFFUL)) { return 1; }
+
+	instance->method = params->method;
+	instance->loadCountValue = params->loadCountValue;
+	instance->startTicks = 0;
+	instance->stopCount = count_of_elapsed(instance, 0);
+	instance->running = false;
+
+	return 0;
+}
+
+/**
+ * @brief	Start counting
+ * @param	self			Timer*
+ * @return	none
+ */
+void CclockTimer_start(struct Timer* const self)
+{
+	struct CclockTimer* const instance = (struct CclockTimer*)self;
+
+	if (instance->running) { return; }
+
+	const uint32_t elapsed = (instance->method == kTIMER_COUNT_METHOD_UP) ?
+			instance->stopCount : (uint32_t)(instance->loadCountValue - instance->stopCount);
+	instance->startTicks = host_ticks() - elapsed;
+	instance->running = true;
+}
+
+/**
+ * @brief	Stop counting
+ * @param	self			Timer*
+ * @return	none
+ */
+void CclockTimer_stop(struct Timer* const self)
+{
+	struct CclockTimer* const instance = (struct CclockTimer*)self;
+
+	instance->stopCount = CclockTimer_readCounter(self);
+	instance->running = false;
+}
+
+/**
+ * @brief	Read counter value
+ * @param	self			Timer*
+ * @return	counter value
+ */
+uint32_t CclockTimer_readCounter(const struct Timer* const self)
+{
+	const struct CclockTimer* const instance = (const struct CclockTimer*)self;
+
+	if (!instance->running) { return instance->stopCount; }
+
+	return count_of_elapsed(instance, host_ticks() - instance->startTicks);
+}
+
+/**
+ * @brief	Get frequency
+ * @param	self			Timer*
+ * @return	frequency
+ */
+uint32_t CclockTimer_getFrequency(const struct Timer* const self)
+{
+	(void)self;
+
+	return kFREQ;
+}
+
+/**
+ * @brief	Assign virtual functions
+ * @param	instance		instance
+ * @return	none
+ *
+ * @note The interrupt functions stay the defaults of Timer (no interrupts).
+ */
+static void assignVirtualFunctions(struct CclockTimer* const instance)
+{
+	instance->timer.destroy				= CclockTimer_destroy;
+	instance->timer.setup				= CclockTimer_setup;
+
+	instance->timer.start				= CclockTimer_start;
+	instance->timer.stop				= CclockTimer_stop;
+
+	instance->timer.readCounter			= CclockTimer_readCounter;
+	instance->timer.getFrequency		= CclockTimer_getFrequency;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file	cclock_timer.h
+ * @brief	host clock timer/counter (for the free run counter on a host build)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_DEVICE_CCLOCK_TIMER_H_INCLUDED_
+#define SDPSES_DEVICE_CCLOCK_TIMER_H_INCLUDED_
+
+#include "timer.h"
+
+struct CclockTimer;
+
+size_t CclockTimer_sizeOf(void);
+
+struct CclockTimer* CclockTimer_create(void);
+struct Timer* CclockTimer_destroy(struct Timer* self);
+
+int CclockTimer_ctor(struct CclockTimer* instance);
+void CclockTimer_dtor(struct CclockTimer* instance);
+
+int CclockTimer_setup(struct Timer* self, const TimerCountParams* params);
+
+void CclockTimer_start(struct Timer* self);
+void CclockTimer_stop(struct Timer* self);
+
+uint32_t CclockTimer_readCounter(const struct Timer* self);
+uint32_t CclockTimer_getFrequency(const struct Timer* self);
+
+#endif /* SDPSES_DEVICE_CCLOCK_TIMER_H_INCLUDED_ */
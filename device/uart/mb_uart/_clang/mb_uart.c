@@ -17,6 +17,7 @@
 #include "xintc_l.h"
 
 #include "allocator.h"
+#include "allocator_budget.h"
 #include "xuartlite_l.h"
 #include "uart_private.h"
 #include "mb_uart.h"
@@ -43,12 +44,17 @@ struct MbUart {
 
 	unsigned int framePeriodUsec;
 
+	bool queuesEmbedded;	/*!< the queues are in the block of the instance (see MbUart_blockSize()) */
 	FixedQueue8* txQueue;
 	FixedQueue8* rxQueue;
 
 	const FreeRunCounter* freeRunCounter;
+
+	struct Allocator* heap;	/*!< heap of the instance and the queues (NULL: the default heap) */
 };
 
+ALLOCATOR_BUDGET_STATIC_ASSERT_(sizeof(struct MbUart) <= kMB_UART_BUDGET_INSTANCE, mb_uart_instance);
+
 static inline void XUartLite_WriteTxFifoReg(const uint32_t base_addr, const uint8_t data) {
 	XUartLite_WriteReg(base_addr, XUL_TX_FIFO_OFFSET, data);
 }
@@ -57,11 +63,17 @@ static inline uint8_t XUartLite_ReadRxFifoReg(const uint32_t base_addr) {
 	return XUartLite_ReadReg(base_addr, XUL_RX_FIFO_OFFSET);
 }
 
+static int construct(struct MbUart* instance, struct Allocator* heap, uint32_t base_addr,
+		uint32_t ic_base, uint32_t irq, const MbUartParams* uart_params, uint8_t* queue_block);
+static FixedQueue8* createQueue(const struct MbUart* instance, uint8_t* header, uint8_t* storage, size_t size_max);
+static FixedQueue8* destroyQueue(const struct MbUart* instance, FixedQueue8* queue);
+
 static int validateSerialParams(const SerialParams* params);
 
 static void clearBuffer(struct MbUart* instance);
 static int waitTxFifoReady(const struct MbUart* instance);
 static int waitTxFifoEmpty(const struct MbUart* instance);
+static void startTransmit(struct MbUart* instance);
 static void writeToTxFifo(struct MbUart* instance);
 
 static void setupInterrupt(struct MbUart* instance);
@@ -80,6 +92,18 @@ size_t MbUart_sizeOf(void)
 	return sizeof(struct MbUart);
 }
 
+/**
+ * @brief	Get the size of the block of MbUart_create()
+ * @param	uart_params		MbUartParams
+ * @return	the size of the instance and the queues
+ *
+ * @note e.g. the object size of an ObjectCache of UARTs.
+ */
+size_t MbUart_blockSize(const MbUartParams* const uart_params)
+{
+	return sizeof(struct MbUart) + (2 * FixedQueue8_sizeOf()) + uart_params->txBuffSz + uart_params->rxBuffSz;
+}
+
 /**
  * @brief	Create
  * @param	base_addr		base address
@@ -87,18 +111,39 @@ size_t MbUart_sizeOf(void)
  * @param	irq				irq number
  * @param	uart_params		MbUartParams
  * @return	instance
+ *
+ * @note The instance and the queues are placed in the fast region (used by the ISR).
  */
 struct MbUart* MbUart_create(const uint32_t base_addr, const uint32_t ic_base,
 		const uint32_t irq, const MbUartParams* const uart_params)
 {
-	struct MbUart* const instance = Allocator_allocate(sizeof(struct MbUart));
-	if (!instance) {
+	return MbUart_createFrom(Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST), base_addr, ic_base, irq, uart_params);
+}
+
+/**
+ * @brief	Create on a heap
+ * @param	heap			heap of the instance and the queues (NULL: the default heap)
+ * @param	base_addr		base address
+ * @param	ic_base			intc base address
+ * @param	irq				irq number
+ * @param	uart_params		MbUartParams
+ * @return	instance
+ *
+ * @note The instance and the queues are one block of the heap (MbUart_blockSize()):
+ *       [MbUart][TX FixedQueue8][RX FixedQueue8][TX storage][RX storage]
+ */
+struct MbUart* MbUart_createFrom(struct Allocator* const heap, const uint32_t base_addr,
+		const uint32_t ic_base, const uint32_t irq, const MbUartParams* const uart_params)
+{
+	uint8_t* const block = Allocator_allocateFrom(heap, MbUart_blockSize(uart_params));
+	if (!block) {
 		DEBUG_PRINTF_("Cannot allocate memory\r\n");
 		return NULL;
 	}
 
-	if (MbUart_ctor(instance, base_addr, ic_base, irq, uart_params)) {
-		Allocator_deallocate(instance);
+	struct MbUart* const instance = (struct MbUart*)block;
+	if (construct(instance, heap, base_addr, ic_base, irq, uart_params, block + sizeof(struct MbUart))) {
+		Allocator_deallocateFrom(heap, instance);
 		return NULL;
 	}
 
@@ -115,8 +160,9 @@ struct Uart* MbUart_destroy(struct Uart* const self)
 	if (!self) { return NULL; }
 
 	struct MbUart* const instance = (struct MbUart*)self;
+	struct Allocator* const heap = instance->heap;
 	MbUart_dtor(instance);
-	Allocator_deallocate(instance);
+	Allocator_deallocateFrom(heap, instance);
 
 	return NULL;
 }
@@ -130,9 +176,46 @@ struct Uart* MbUart_destroy(struct Uart* const self)
  * @param	uart_params		MbUartParams
  * @retval	0				success
  * @retval	!=0				failure
+ *
+ * @note The queues are placed in the fast region (used by the ISR).
  */
 int MbUart_ctor(struct MbUart* const instance, const uint32_t base_addr,
 		const uint32_t ic_base, const uint32_t irq, const MbUartParams* const uart_params)
+{
+	return MbUart_ctorFrom(instance, Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST), base_addr, ic_base, irq, uart_params);
+}
+
+/**
+ * @brief	Constructor with the queues on a heap
+ * @param	instance		instance
+ * @param	heap			heap of the queues (NULL: the default heap)
+ * @param	base_addr		base address
+ * @param	ic_base			intc base address
+ * @param	irq				irq number
+ * @param	uart_params		MbUartParams
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+int MbUart_ctorFrom(struct MbUart* const instance, struct Allocator* const heap, const uint32_t base_addr,
+		const uint32_t ic_base, const uint32_t irq, const MbUartParams* const uart_params)
+{
+	return construct(instance, heap, base_addr, ic_base, irq, uart_params, NULL);
+}
+
+/**
+ * @brief	Construct
+ * @param	instance		instance
+ * @param	heap			heap of the queues (NULL: the default heap)
+ * @param	base_addr		base address
+ * @param	ic_base			intc base address
+ * @param	irq				irq number
+ * @param	uart_params		MbUartParams
+ * @param	queue_block		the queues follow the instance in its block (NULL: from the heap)
+ * @retval	0				success
+ * @retval	!=0				failure
+ */
+static int construct(struct MbUart* const instance, struct Allocator* const heap, const uint32_t base_addr,
+		const uint32_t ic_base, const uint32_t irq, const MbUartParams* const uart_params, uint8_t* const queue_block)
 {
 	DEBUG_PRINTF_("<MicroBlaze UART parameters>\r\n");
 	DEBUG_PRINTF_("  BASE ADDR     : [H'%08lX]\r\n", base_addr);
@@ -155,16 +238,23 @@ int MbUart_ctor(struct MbUart* const instance, const uint32_t base_addr,
 	instance->lastError			= 0;
 	instance->framePeriodUsec	= 0;
 
+	instance->heap = heap;
+	instance->queuesEmbedded = (queue_block != NULL);
 	instance->txQueue = NULL;
 	instance->rxQueue = NULL;
 
+	uint8_t* const txHeader = queue_block;
+	uint8_t* const rxHeader = (queue_block) ? (txHeader + FixedQueue8_sizeOf()) : NULL;
+	uint8_t* const txStorage = (queue_block) ? (rxHeader + FixedQueue8_sizeOf()) : NULL;
+	uint8_t* const rxStorage = (queue_block) ? (txStorage + uart_params->txBuffSz) : NULL;
+
 	if (uart_params->txBuffSz) {
-		instance->txQueue = FixedQueue8_create(uart_params->txBuffSz);
+		instance->txQueue = createQueue(instance, txHeader, txStorage, uart_params->txBuffSz);
 		if (!instance->txQueue) { goto TERMINATE; }
 	}
 
 	if (uart_params->rxBuffSz) {
-		instance->rxQueue = FixedQueue8_create(uart_params->rxBuffSz);
+		instance->rxQueue = createQueue(instance, rxHeader, rxStorage, uart_params->rxBuffSz);
 		if (!instance->rxQueue) { goto TERMINATE; }
 	}
 
@@ -182,8 +272,8 @@ int MbUart_ctor(struct MbUart* const instance, const uint32_t base_addr,
 	return 0;
 
 TERMINATE:
-	if (instance->txQueue) { instance->txQueue = FixedQueue8_destroy(instance->txQueue); }
-	if (instance->rxQueue) { instance->rxQueue = FixedQueue8_destroy(instance->rxQueue); }
+	if (instance->txQueue) { instance->txQueue = destroyQueue(instance, instance->txQueue); }
+	if (instance->rxQueue) { instance->rxQueue = destroyQueue(instance, instance->rxQueue); }
 	return 1;
 }
 
@@ -199,8 +289,8 @@ void MbUart_dtor(struct MbUart* const instance)
 	XUartLite_DisableIntr(instance->baseAddr);
 	XIntc_DisableIntr(instance->icBase, instance->irqMask);
 
-	if (instance->txQueue) { instance->txQueue = FixedQueue8_destroy(instance->txQueue); }
-	if (instance->rxQueue) { instance->rxQueue = FixedQueue8_destroy(instance->rxQueue); }
+	if (instance->txQueue) { instance->txQueue = destroyQueue(instance, instance->txQueue); }
+	if (instance->rxQueue) { instance->rxQueue = destroyQueue(instance, instance->rxQueue); }
 
 	Uart_dtor((struct Uart*)instance);
 }
@@ -306,13 +396,11 @@ int MbUart_get(struct Uart* const self, uint8_t* const data)
 	int rc = 1;
 	struct MbUart* const instance = (struct MbUart*)self;
 
-	XIntc_DisableIntr(instance->icBase, instance->irqMask);
 	if (!FixedQueue8_empty(instance->rxQueue)) {
 		*data = FixedQueue8_front(instance->rxQueue);
 		FixedQueue8_pop(instance->rxQueue);
 		rc = 0;
 	}
-	XIntc_EnableIntr(instance->icBase, instance->irqMask);
 
 	return rc;
 }
@@ -329,21 +417,15 @@ int MbUart_put(struct Uart* const self, const uint8_t data)
 	int rc = 1;
 	struct MbUart* const instance = (struct MbUart*)self;
 
-	XIntc_DisableIntr(instance->icBase, instance->irqMask);
-	if ((XUartLite_GetStatusReg(instance->baseAddr) & XUL_SR_TX_FIFO_FULL) == 0) {
-		if (FixedQueue8_empty(instance->txQueue)) {
-			XUartLite_WriteTxFifoReg(instance->baseAddr, data);
-		} else {
-			XUartLite_WriteTxFifoReg(instance->baseAddr, FixedQueue8_front(instance->txQueue));
-			FixedQueue8_pop(instance->txQueue);
-			FixedQueue8_push(instance->txQueue, data);
-		}
+	if (FixedQueue8_empty(instance->txQueue)
+			&& ((XUartLite_GetStatusReg(instance->baseAddr) & XUL_SR_TX_FIFO_FULL) == 0)) {
+		XUartLite_WriteTxFifoReg(instance->baseAddr, data);
 		rc = 0;
 	} else if (!FixedQueue8_full(instance->txQueue)) {
 		FixedQueue8_push(instance->txQueue, data);
 		rc = 0;
 	}
-	XIntc_EnableIntr(instance->icBase, instance->irqMask);
+	startTransmit(instance);
 
 	return rc;
 }
@@ -361,16 +443,10 @@ int MbUart_read(struct Uart* const self, uint8_t data_buff[], const unsigned int
 	int rc = 1;
 	struct MbUart* const instance = (struct MbUart*)self;
 
-	XIntc_DisableIntr(instance->icBase, instance->irqMask);
 	if (FixedQueue8_size(instance->rxQueue) >= data_count) {
-		unsigned int i;
-		for (i = 0; i < data_count; i++) {
-			data_buff[i] = FixedQueue8_front(instance->rxQueue);
-			FixedQueue8_pop(instance->rxQueue);
-		}
+		FixedQueue8_popN(instance->rxQueue, data_buff, data_count);
 		rc = 0;
 	}
-	XIntc_EnableIntr(instance->icBase, instance->irqMask);
 
 	return rc;
 }
@@ -388,16 +464,11 @@ int MbUart_write(struct Uart* const self, const uint8_t data_buff[], const unsig
 	int rc = 1;
 	struct MbUart* const instance = (struct MbUart*)self;
 
-	XIntc_DisableIntr(instance->icBase, instance->irqMask);
 	if (FixedQueue8_availableSize(instance->txQueue) >= data_count) {
-		unsigned int i;
-		for (i = 0; i < data_count; i++) {
-			FixedQueue8_push(instance->txQueue, data_buff[i]);
-		}
+		FixedQueue8_pushN(instance->txQueue, data_buff, data_count);
 		rc = 0;
 	}
-	writeToTxFifo(instance);
-	XIntc_EnableIntr(instance->icBase, instance->irqMask);
+	startTransmit(instance);
 
 	return rc;
 }
@@ -496,6 +567,24 @@ static int waitTxFifoEmpty(const struct MbUart* const instance)
 	return 0;
 }
 
+/**
+ * @brief	Start transmission
+ * @param	instance		instance
+ * @return	none
+ *
+ * @note The TX interrupt only occurs when the TX-FIFO becomes empty. While the
+ *       FIFO still holds data that interrupt will drain the queue, so the ISR
+ *       is masked only when the FIFO is already empty and must be primed here.
+ */
+static void startTransmit(struct MbUart* const instance)
+{
+	if (XUartLite_GetStatusReg(instance->baseAddr) & XUL_SR_TX_FIFO_EMPTY) {
+		XIntc_DisableIntr(instance->icBase, instance->irqMask);
+		writeToTxFifo(instance);
+		XIntc_EnableIntr(instance->icBase, instance->irqMask);
+	}
+}
+
 /**
  * @brief	Write to TX-FIFO
  * @param	instance		instance
@@ -503,11 +592,23 @@ static int waitTxFifoEmpty(const struct MbUart* const instance)
  */
 static void writeToTxFifo(struct MbUart* const instance)
 {
-	for (int i = 0; i < XUL_FIFO_SIZE; i++) {
-		if (XUartLite_GetStatusReg(instance->baseAddr) & XUL_SR_TX_FIFO_FULL) { break; }
-		if (FixedQueue8_empty(instance->txQueue)) { break; }
-		XUartLite_WriteTxFifoReg(instance->baseAddr, FixedQueue8_front(instance->txQueue));
-		FixedQueue8_pop(instance->txQueue);
+	size_t written = 0;
+
+	/* at most two contiguous segments: the second one after the queue wraps */
+	for (int segment = 0; segment < 2; segment++) {
+		size_t spanSize;
+		const uint8_t* const span = FixedQueue8_readableSpan(instance->txQueue, &spanSize);
+		size_t count = 0;
+
+		while ((count < spanSize) && (written < XUL_FIFO_SIZE)) {
+			if (XUartLite_GetStatusReg(instance->baseAddr) & XUL_SR_TX_FIFO_FULL) { break; }
+			XUartLite_WriteTxFifoReg(instance->baseAddr, span[count]);
+			count++;
+			written++;
+		}
+		FixedQueue8_commitRead(instance->txQueue, count);
+
+		if ((count == 0) || (count < spanSize)) { break; }
 	}
 }
 
@@ -642,6 +743,37 @@ static void receiveInterrupt(struct MbUart* const instance)
 	}
 }
 
+/**
+ * @brief	Create a queue
+ * @param	instance		instance
+ * @param	header			place of the queue in the block of the instance (if embedded)
+ * @param	storage			storage in the block of the instance (if embedded)
+ * @param	size_max		the maximum number of elements
+ * @return	queue (NULL: failure)
+ */
+static FixedQueue8* createQueue(const struct MbUart* const instance,
+		uint8_t* const header, uint8_t* const storage, const size_t size_max)
+{
+	if (!instance->queuesEmbedded) { return FixedQueue8_createFrom(instance->heap, size_max); }
+
+	FixedQueue8* const queue = (FixedQueue8*)header;
+	return (FixedQueue8_ctorOn(queue, storage, size_max)) ? NULL : queue;
+}
+
+/**
+ * @brief	Destroy a queue
+ * @param	instance		instance
+ * @param	queue			queue
+ * @return	NULL
+ */
+static FixedQueue8* destroyQueue(const struct MbUart* const instance, FixedQueue8* const queue)
+{
+	if (!instance->queuesEmbedded) { return FixedQueue8_destroy(queue); }
+
+	FixedQueue8_dtor(queue);
+	return NULL;
+}
+
 /**
  * @brief	Assign virtual functions
  * @param	instance		instance
@@ -25,15 +25,27 @@ typedef struct {
 } MbUartParams;
 
 struct MbUart;
+struct Allocator;
+
+/*! @note Worst-case footprint of MbUart_create() for the memory budget (see allocator_budget.h and fixed_queue8.h) */
+enum { kMB_UART_BUDGET_INSTANCE = ((16 * sizeof(void*)) + (10 * sizeof(uint32_t))) };
+#define MB_UART_BUDGET_(tx_buff_sz, rx_buff_sz) \
+	ALLOCATOR_BUDGET_BLOCK_(kMB_UART_BUDGET_INSTANCE + (2 * kFIXED_QUEUE8_BUDGET_INSTANCE) \
+	+ (tx_buff_sz) + (rx_buff_sz))
 
 size_t MbUart_sizeOf(void);
+size_t MbUart_blockSize(const MbUartParams* uart_params);
 
 struct MbUart* MbUart_create(uint32_t base_addr, uint32_t ic_base,
 		uint32_t irq, const MbUartParams* uart_params);
+struct MbUart* MbUart_createFrom(struct Allocator* heap, uint32_t base_addr,
+		uint32_t ic_base, uint32_t irq, const MbUartParams* uart_params);
 struct Uart* MbUart_destroy(struct Uart* self);
 
 int MbUart_ctor(struct MbUart* instance, uint32_t base_addr,
 		uint32_t ic_base, uint32_t irq, const MbUartParams* uart_params);
+int MbUart_ctorFrom(struct MbUart* instance, struct Allocator* heap, uint32_t base_addr,
+		uint32_t ic_base, uint32_t irq, const MbUartParams* uart_params);
 void MbUart_dtor(struct MbUart* instance);
 
 int MbUart_setup(struct Uart* self, const SerialParams* params);
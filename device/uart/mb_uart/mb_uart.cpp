@@ -51,8 +51,13 @@ MbUart::MbUart(const uint32_t base_addr, const uint32_t ic_base,
 	, errorMask_(0)
 	, lastError_(0)
 	, framePeriodUsec_(0)
+#if defined(USE_ORIGINAL_ALLOCATOR_)
+	, txQueue_(params.kTX_BUFF_SZ, Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST))
+	, rxQueue_(params.kRX_BUFF_SZ, Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST))
+#else
 	, txQueue_(params.kTX_BUFF_SZ)
 	, rxQueue_(params.kRX_BUFF_SZ)
+#endif /* USE_ORIGINAL_ALLOCATOR_ */
 	, freeRunCounter_(FreeRunCounter::getInstance())
 {
 	DEBUG_PRINTF_("<MicroBlaze UART parameters>\r\n");
@@ -171,13 +176,11 @@ int MbUart::get(uint8_t* const data)
 {
 	int rc = 1;
 
-	XIntc_DisableIntr(kIC_BASE, kIRQ_MASK);
 	if (!rxQueue_.empty()) {
 		*data = rxQueue_.front();
 		rxQueue_.pop();
 		rc = 0;
 	}
-	XIntc_EnableIntr(kIC_BASE, kIRQ_MASK);
 
 	return rc;
 }
@@ -192,21 +195,14 @@ int MbUart::put(const uint8_t data)
 {
 	int rc = 1;
 
-	XIntc_DisableIntr(kIC_BASE, kIRQ_MASK);
-	if ((XUartLite_GetStatusReg(kBASE_ADDR) & XUL_SR_TX_FIFO_FULL) == 0) {
-		if (txQueue_.empty()) {
-			XUartLite_WriteTxFifoReg(kBASE_ADDR, data);
-		} else {
-			XUartLite_WriteTxFifoReg(kBASE_ADDR, txQueue_.front());
-			txQueue_.pop();
-			txQueue_.push(data);
-		}
+	if (txQueue_.empty() && ((XUartLite_GetStatusReg(kBASE_ADDR) & XUL_SR_TX_FIFO_FULL) == 0)) {
+		XUartLite_WriteTxFifoReg(kBASE_ADDR, data);
 		rc = 0;
 	} else if (!txQueue_.full()) {
 		txQueue_.push(data);
 		rc = 0;
 	}
-	XIntc_EnableIntr(kIC_BASE, kIRQ_MASK);
+	startTransmit();
 
 	return rc;
 }
@@ -222,15 +218,10 @@ int MbUart::read(uint8_t data_buff[], const unsigned int data_count)
 {
 	int rc = 1;
 
-	XIntc_DisableIntr(kIC_BASE, kIRQ_MASK);
 	if (rxQueue_.size() >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			data_buff[i] = rxQueue_.front();
-			rxQueue_.pop();
-		}
+		rxQueue_.pop(data_buff, data_count);
 		rc = 0;
 	}
-	XIntc_EnableIntr(kIC_BASE, kIRQ_MASK);
 
 	return rc;
 }
@@ -246,15 +237,11 @@ int MbUart::write(const uint8_t data_buff[], const unsigned int data_count)
 {
 	int rc = 1;
 
-	XIntc_DisableIntr(kIC_BASE, kIRQ_MASK);
 	if (txQueue_.availableSize() >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			txQueue_.push(data_buff[i]);
-		}
+		txQueue_.push(data_buff, data_count);
 		rc = 0;
 	}
-	writeToTxFifo();
-	XIntc_EnableIntr(kIC_BASE, kIRQ_MASK);
+	startTransmit();
 
 	return rc;
 }
@@ -345,17 +332,46 @@ int MbUart::waitTxFifoEmpty() const
 	return 0;
 }
 
+/**
+ * @brief	Start transmission
+ * @return	none
+ *
+ * @note The TX interrupt only occurs when the TX-FIFO becomes empty. While the
+ *       FIFO still holds data that interrupt will drain the queue, so the ISR
+ *       is masked only when the FIFO is already empty and must be primed here.
+ */
+void MbUart::startTransmit()
+{
+	if (XUartLite_GetStatusReg(kBASE_ADDR) & XUL_SR_TX_FIFO_EMPTY) {
+		XIntc_DisableIntr(kIC_BASE, kIRQ_MASK);
+		writeToTxFifo();
+		XIntc_EnableIntr(kIC_BASE, kIRQ_MASK);
+	}
+}
+
 /**
  * @brief	Write to TX-FIFO
  * @return	none
  */
 void MbUart::writeToTxFifo()
 {
-	for (int i = 0; i < XUL_FIFO_SIZE; i++) {
-		if (XUartLite_GetStatusReg(kBASE_ADDR) & XUL_SR_TX_FIFO_FULL) { break; }
-		if (txQueue_.empty()) { break; }
-		XUartLite_WriteTxFifoReg(kBASE_ADDR, txQueue_.front());
-		txQueue_.pop();
+	std::size_t written = 0;
+
+	/* at most two contiguous segments: the second one after the queue wraps */
+	for (int segment = 0; segment < 2; segment++) {
+		std::size_t spanSize;
+		const uint8_t* const span = txQueue_.readableSpan(&spanSize);
+		std::size_t count = 0;
+
+		while ((count < spanSize) && (written < XUL_FIFO_SIZE)) {
+			if (XUartLite_GetStatusReg(kBASE_ADDR) & XUL_SR_TX_FIFO_FULL) { break; }
+			XUartLite_WriteTxFifoReg(kBASE_ADDR, span[count]);
+			count++;
+			written++;
+		}
+		txQueue_.commitRead(count);
+
+		if ((count == 0) || (count < spanSize)) { break; }
 	}
 }
 
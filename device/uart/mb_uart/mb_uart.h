@@ -89,6 +89,7 @@ private:
 	void clearBuffer();
 	int waitTxFifoReady() const;
 	int waitTxFifoEmpty() const;
+	void startTransmit();
 	void writeToTxFifo();
 
 	void setupInterrupt();
@@ -56,6 +56,7 @@ static int waitStatusReady(const struct NiosUart* instance, uint16_t status);
 
 static int setupInterrupt(struct NiosUart* instance);
 static void interruptServiceRoutine(void* isr_context);
+static void enableTransmitInterrupt(struct NiosUart* instance);
 static void transmitInterrupt(struct NiosUart* instance);
 static void receiveInterrupt(struct NiosUart* instance);
 
@@ -161,12 +162,12 @@ int NiosUart_ctor(struct NiosUart* const instance, const uint32_t base_addr,
 	instance->rxQueue = NULL;
 
 	if (uart_params->txBuffSz) {
-		instance->txQueue = FixedQueue8_create(uart_params->txBuffSz);
+		instance->txQueue = FixedQueue8_createFrom(Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST), uart_params->txBuffSz);
 		if (!instance->txQueue) { goto TERMINATE; }
 	}
 
 	if (uart_params->rxBuffSz) {
-		instance->rxQueue = FixedQueue8_create(uart_params->rxBuffSz);
+		instance->rxQueue = FixedQueue8_createFrom(Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST), uart_params->rxBuffSz);
 		if (!instance->rxQueue) { goto TERMINATE; }
 	}
 
@@ -310,13 +311,11 @@ int NiosUart_get(struct Uart* const self, uint8_t* const data)
 	int rc = 1;
 	struct NiosUart* const instance = (struct NiosUart*)self;
 
-	alt_ic_irq_disable(instance->icId, instance->irq);
 	if (!FixedQueue8_empty(instance->rxQueue)) {
 		*data = FixedQueue8_front(instance->rxQueue);
 		FixedQueue8_pop(instance->rxQueue);
 		rc = 0;
 	}
-	alt_ic_irq_enable(instance->icId, instance->irq);
 
 	return rc;
 }
@@ -333,23 +332,15 @@ int NiosUart_put(struct Uart* const self, const uint8_t data)
 	int rc = 1;
 	struct NiosUart* const instance = (struct NiosUart*)self;
 
-	alt_ic_irq_disable(instance->icId, instance->irq);
-	if (IORD_ALTERA_AVALON_UART_STATUS(instance->baseAddr) & ALTERA_AVALON_UART_STATUS_TRDY_MSK) {
-		if (FixedQueue8_empty(instance->txQueue)) {
-			IOWR_ALTERA_AVALON_UART_TXDATA(instance->baseAddr, data);
-		} else {
-			IOWR_ALTERA_AVALON_UART_TXDATA(instance->baseAddr, FixedQueue8_front(instance->txQueue));
-			FixedQueue8_pop(instance->txQueue);
-			FixedQueue8_push(instance->txQueue, data);
-		}
+	if (FixedQueue8_empty(instance->txQueue)
+			&& (IORD_ALTERA_AVALON_UART_STATUS(instance->baseAddr) & ALTERA_AVALON_UART_STATUS_TRDY_MSK)) {
+		IOWR_ALTERA_AVALON_UART_TXDATA(instance->baseAddr, data);
 		rc = 0;
 	} else if (!FixedQueue8_full(instance->txQueue)) {
 		FixedQueue8_push(instance->txQueue, data);
 		rc = 0;
 	}
-	instance->interruptFlags |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
-	IOWR_ALTERA_AVALON_UART_CONTROL(instance->baseAddr, instance->interruptFlags);
-	alt_ic_irq_enable(instance->icId, instance->irq);
+	enableTransmitInterrupt(instance);
 
 	return rc;
 }
@@ -367,15 +358,10 @@ int NiosUart_read(struct Uart* const self, uint8_t data_buff[], const unsigned i
 	int rc = 1;
 	struct NiosUart* const instance = (struct NiosUart*)self;
 
-	alt_ic_irq_disable(instance->icId, instance->irq);
 	if (FixedQueue8_size(instance->rxQueue) >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			data_buff[i] = FixedQueue8_front(instance->rxQueue);
-			FixedQueue8_pop(instance->rxQueue);
-		}
+		FixedQueue8_popN(instance->rxQueue, data_buff, data_count);
 		rc = 0;
 	}
-	alt_ic_irq_enable(instance->icId, instance->irq);
 
 	return rc;
 }
@@ -393,16 +379,11 @@ int NiosUart_write(struct Uart* const self, const uint8_t data_buff[], const uns
 	int rc = 1;
 	struct NiosUart* const instance = (struct NiosUart*)self;
 
-	alt_ic_irq_disable(instance->icId, instance->irq);
 	if (FixedQueue8_availableSize(instance->txQueue) >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			FixedQueue8_push(instance->txQueue, data_buff[i]);
-		}
+		FixedQueue8_pushN(instance->txQueue, data_buff, data_count);
 		rc = 0;
 	}
-	instance->interruptFlags |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
-	IOWR_ALTERA_AVALON_UART_CONTROL(instance->baseAddr, instance->interruptFlags);
-	alt_ic_irq_enable(instance->icId, instance->irq);
+	enableTransmitInterrupt(instance);
 
 	return rc;
 }
@@ -598,6 +579,21 @@ static void interruptServiceRoutine(void* const isr_context)
 	if (status & ALTERA_AVALON_UART_STATUS_TRDY_MSK) { transmitInterrupt(instance); }
 }
 
+/**
+ * @brief	Enable transmit interrupt
+ * @param	instance		instance
+ * @return	none
+ *
+ * @note This does not mask the ISR. The ISR only clears TRDY when the TX queue
+ *       is empty, and the caller has already pushed its data, so a stale copy of
+ *       the flags at worst causes one extra, harmless transmit interrupt.
+ */
+static void enableTransmitInterrupt(struct NiosUart* const instance)
+{
+	instance->interruptFlags |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
+	IOWR_ALTERA_AVALON_UART_CONTROL(instance->baseAddr, instance->interruptFlags);
+}
+
 /**
  * @brief	Transmit Interrupt Processing
  * @param	instance		instance
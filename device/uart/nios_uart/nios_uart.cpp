@@ -175,13 +175,11 @@ int NiosUart::get(uint8_t* const data)
 {
 	int rc = 1;
 
-	alt_ic_irq_disable(kIC_ID, kIRQ);
 	if (!rxQueue_.empty()) {
 		*data = rxQueue_.front();
 		rxQueue_.pop();
 		rc = 0;
 	}
-	alt_ic_irq_enable(kIC_ID, kIRQ);
 
 	return rc;
 }
@@ -196,23 +194,14 @@ int NiosUart::put(const uint8_t data)
 {
 	int rc = 1;
 
-	alt_ic_irq_disable(kIC_ID, kIRQ);
-	if (IORD_ALTERA_AVALON_UART_STATUS(kBASE_ADDR) & ALTERA_AVALON_UART_STATUS_TRDY_MSK) {
-		if (txQueue_.empty()) {
-			IOWR_ALTERA_AVALON_UART_TXDATA(kBASE_ADDR, data);
-		} else {
-			IOWR_ALTERA_AVALON_UART_TXDATA(kBASE_ADDR, txQueue_.front());
-			txQueue_.pop();
-			txQueue_.push(data);
-		}
+	if (txQueue_.empty() && (IORD_ALTERA_AVALON_UART_STATUS(kBASE_ADDR) & ALTERA_AVALON_UART_STATUS_TRDY_MSK)) {
+		IOWR_ALTERA_AVALON_UART_TXDATA(kBASE_ADDR, data);
 		rc = 0;
 	} else if (!txQueue_.full()) {
 		txQueue_.push(data);
 		rc = 0;
 	}
-	interruptFlags_ |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
-	IOWR_ALTERA_AVALON_UART_CONTROL(kBASE_ADDR, interruptFlags_);
-	alt_ic_irq_enable(kIC_ID, kIRQ);
+	enableTransmitInterrupt();
 
 	return rc;
 }
@@ -228,15 +217,10 @@ int NiosUart::read(uint8_t data_buff[], const unsigned int data_count)
 {
 	int rc = 1;
 
-	alt_ic_irq_disable(kIC_ID, kIRQ);
 	if (rxQueue_.size() >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			data_buff[i] = rxQueue_.front();
-			rxQueue_.pop();
-		}
+		rxQueue_.pop(data_buff, data_count);
 		rc = 0;
 	}
-	alt_ic_irq_enable(kIC_ID, kIRQ);
 
 	return rc;
 }
@@ -252,16 +236,11 @@ int NiosUart::write(const uint8_t data_buff[], const unsigned int data_count)
 {
 	int rc = 1;
 
-	alt_ic_irq_disable(kIC_ID, kIRQ);
 	if (txQueue_.availableSize() >= data_count) {
-		for (unsigned int i = 0; i < data_count; i++) {
-			txQueue_.push(data_buff[i]);
-		}
+		txQueue_.push(data_buff, data_count);
 		rc = 0;
 	}
-	interruptFlags_ |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
-	IOWR_ALTERA_AVALON_UART_CONTROL(kBASE_ADDR, interruptFlags_);
-	alt_ic_irq_enable(kIC_ID, kIRQ);
+	enableTransmitInterrupt();
 
 	return rc;
 }
@@ -436,6 +415,20 @@ void NiosUart::interruptServiceRoutine(void* const isr_context)
 	if (status & ALTERA_AVALON_UART_STATUS_TRDY_MSK) { instance->transmitInterrupt(); }
 }
 
+/**
+ * @brief	Enable transmit interrupt
+ * @return	none
+ *
+ * @note This does not mask the ISR. The ISR only clears TRDY when the TX queue
+ *       is empty, and the caller has already pushed its data, so a stale copy of
+ *       the flags at worst causes one extra, harmless transmit interrupt.
+ */
+void NiosUart::enableTransmitInterrupt()
+{
+	interruptFlags_ |= ALTERA_AVALON_UART_CONTROL_TRDY_MSK;
+	IOWR_ALTERA_AVALON_UART_CONTROL(kBASE_ADDR, interruptFlags_);
+}
+
 /**
  * @brief	Transmit Interrupt Processing
  * @return	none
@@ -95,6 +95,7 @@ private:
 
 	int setupInterrupt();
 	static void interruptServiceRoutine(void* isr_context);
+	void enableTransmitInterrupt();
 	void transmitInterrupt();
 	void receiveInterrupt();
 };
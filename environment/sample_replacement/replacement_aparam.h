@@ -26,8 +26,10 @@
 
 #if defined(ALT_CPU_DCACHE_SIZE)
 #  define MPU_DCACHE_SIZE		ALT_CPU_DCACHE_SIZE
+#  define MPU_DCACHE_LINE_SIZE	ALT_CPU_DCACHE_LINE_SIZE
 #else
 #  define MPU_DCACHE_SIZE		0
+#  define MPU_DCACHE_LINE_SIZE	0
 #endif
 
 /*! peripherals */
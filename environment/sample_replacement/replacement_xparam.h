@@ -24,8 +24,10 @@
 
 #if (XPAR_MICROBLAZE_0_USE_DCACHE == 1)
 #define MPU_DCACHE_SIZE			XPAR_MICROBLAZE_0_DCACHE_BYTE_SIZE
+#define MPU_DCACHE_LINE_SIZE	(XPAR_MICROBLAZE_0_DCACHE_LINE_LEN * 4)
 #else
 #define MPU_DCACHE_SIZE			0
+#define MPU_DCACHE_LINE_SIZE	0
 #endif
 
 /*! peripherals */
@@ -14,25 +14,56 @@
  * http://opensource.org/licenses/mit-license.php
  */
 
+#include <string.h>
+
 #include "allocator_private.h"
 #include "lib_assert.h"
+#include "lib_critical_section.h"
+
+static struct Allocator* allocator_ = NULL;
+static struct Allocator* placementHeaps_[kALLOCATOR_PLACEMENT_NUM];
+
+/*! @note log2 bucket of the requested size (counting leading zeros on both targets) */
+static inline size_t histogram_index(const size_t size) {
+	if (size < 2) { return 0; }
+	const size_t msb = ((sizeof(unsigned long) * 8) - 1) - (size_t)__builtin_clzl((unsigned long)size);
+	return (msb < kALLOCATOR_HISTOGRAM_SIZE) ? msb : (kALLOCATOR_HISTOGRAM_SIZE - 1);
+}
+
+static inline struct Allocator* heap_or_default(struct Allocator* const heap) {
+	return (heap) ? heap : allocator_;
+}
+
+/*! @note Updates the statistics of the heap and passes the block through. */
+static void* account_allocation(struct Allocator* const self, const size_t size, void* const ptr)
+{
+	struct AllocatorStatistics* const stats = &self->stats;
+	stats->sizeHistogram[histogram_index(size)]++;
+	if (ptr == NULL) {
+		stats->failedRequests++;
+		return NULL;
+	}
 
-static const struct Allocator* allocator_ = NULL;
+	stats->allocationRequests++;
+	stats->liveBytes += (self->blockSize) ? self->blockSize(self, ptr) : size;
+	if (stats->liveBytes > stats->peakBytes) { stats->peakBytes = stats->liveBytes; }
+	stats->liveBlocks++;
+	if (stats->liveBlocks > stats->peakBlocks) { stats->peakBlocks = stats->liveBlocks; }
 
-static unsigned long totalAllocationRequests_ = 0;
-static unsigned long totalDeallocationRequests_ = 0;
+	return ptr;
+}
 
 /**
  * @brief	Initialize
- * @param	allocator		Allocator*
+ * @param	allocator		Allocator* (becomes the default heap)
  * @return	none
  */
-void Allocator_initialize(const struct Allocator* const allocator)
+void Allocator_initialize(struct Allocator* const allocator)
 {
 	allocator_ = allocator;
+	memset(placementHeaps_, 0, sizeof(placementHeaps_));
 
-	totalAllocationRequests_ = 0;
-	totalDeallocationRequests_ = 0;
+	memset(&allocator_->stats, 0, sizeof(allocator_->stats));
 }
 
 /**
@@ -41,8 +72,58 @@ void Allocator_initialize(const struct Allocator* const allocator)
  */
 void Allocator_terminate(void)
 {
-	totalAllocationRequests_ = 0;
-	totalDeallocationRequests_ = 0;
+	if (allocator_) { memset(&allocator_->stats, 0, sizeof(allocator_->stats)); }
+}
+
+/**
+ * @brief	Initialize a heap
+ * @param	heap			Allocator* (the backend functions are already set)
+ * @param	name			name of the heap
+ * @return	none
+ */
+void Allocator_initializeHeap(struct Allocator* const heap, const char* const name)
+{
+	heap->name = name;
+	heap->isrSafe = false;
+	memset(&heap->stats, 0, sizeof(heap->stats));
+}
+
+/**
+ * @brief	Get the default heap
+ * @return	the default heap
+ */
+Allocator* Allocator_defaultHeap(void)
+{
+	return allocator_;
+}
+
+/**
+ * @brief	Set the heap of a placement
+ * @param	placement		AllocatorPlacement
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @return	none
+ *
+ * @note Called by the backend after Allocator_initialize().
+ */
+void Allocator_setPlacementHeap(const enum AllocatorPlacement placement, struct Allocator* const heap)
+{
+	ASSERT_(placement < kALLOCATOR_PLACEMENT_NUM);
+
+	placementHeaps_[placement] = heap;
+}
+
+/**
+ * @brief	Get the heap of a placement
+ * @param	placement		AllocatorPlacement
+ * @return	the heap (the default heap unless the backend has set one)
+ *
+ * @note e.g. Allocator_allocateFrom(Allocator_placementHeap(kALLOCATOR_PLACEMENT_FAST), size)
+ */
+Allocator* Allocator_placementHeap(const enum AllocatorPlacement placement)
+{
+	ASSERT_(placement < kALLOCATOR_PLACEMENT_NUM);
+
+	return heap_or_default(placementHeaps_[placement]);
 }
 
 /**
@@ -53,14 +134,21 @@ void Allocator_terminate(void)
  */
 void* Allocator_allocate(const size_t size)
 {
-	ASSERT_(allocator_ != NULL);
-
-	void* const allocatedPointer = allocator_->allocate(size);
-	if (allocatedPointer != NULL) {
-		totalAllocationRequests_++;
-	}
+	return Allocator_allocateFrom(NULL, size);
+}
 
-	return allocatedPointer;
+/**
+ * @brief	Allocate aligned memory block
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two, 0: the default alignment)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note e.g. kALLOCATOR_CACHE_LINE_SIZE for buffers flushed or invalidated by range.
+ */
+void* Allocator_allocateAligned(const size_t size, const size_t alignment)
+{
+	return Allocator_allocateAlignedFrom(NULL, size, alignment);
 }
 
 /**
@@ -70,26 +158,190 @@ void* Allocator_allocate(const size_t size)
  */
 void Allocator_deallocate(void* const ptr)
 {
-	ASSERT_(allocator_ != NULL);
+	Allocator_deallocateFrom(NULL, ptr);
+}
+
+/**
+ * @brief	Allocate memory block from a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ */
+void* Allocator_allocateFrom(Allocator* const heap, const size_t size)
+{
+	struct Allocator* const self = heap_or_default(heap);
+	ASSERT_(self != NULL);
+
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+	void* const ptr = account_allocation(self, size, self->allocate(self, size));
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+
+	return ptr;
+}
+
+/**
+ * @brief	Allocate aligned memory block from a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two, 0: the default alignment)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note The block is released by Allocator_deallocateFrom().
+ */
+void* Allocator_allocateAlignedFrom(Allocator* const heap, const size_t size, const size_t alignment)
+{
+	struct Allocator* const self = heap_or_default(heap);
+	ASSERT_(self != NULL);
+	ASSERT_((alignment & (alignment - 1)) == 0);
+
+	if (alignment == 0) { return Allocator_allocateFrom(self, size); }
+
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+	void* const ptr = account_allocation(self, size, self->allocateAligned(self, size, alignment));
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+
+	return ptr;
+}
+
+/**
+ * @brief	Deallocate memory block to a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @param	ptr				pointer to a memory block allocated from the heap
+ * @return	none
+ */
+void Allocator_deallocateFrom(Allocator* const heap, void* const ptr)
+{
+	struct Allocator* const self = heap_or_default(heap);
+	ASSERT_(self != NULL);
 
-	totalDeallocationRequests_++;
-	allocator_->deallocate(ptr);
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+
+	struct AllocatorStatistics* const stats = &self->stats;
+	stats->deallocationRequests++;
+	if (ptr != NULL) {
+		if (self->blockSize) { stats->liveBytes -= self->blockSize(self, ptr); }
+		stats->liveBlocks--;
+	}
+	self->deallocate(self, ptr);
+
+	if (self->isrSafe) { lib_critical_section_exit(context); }
 }
 
 /**
  * @brief	Get total number of memory allocation requests
- * @return	total number of memory allocation requests
+ * @return	total number of memory allocation requests (the default heap)
  */
 unsigned long Allocator_totalAllocationRequests(void)
 {
-	return totalAllocationRequests_;
+	return (allocator_) ? allocator_->stats.allocationRequests : 0;
 }
 
 /**
  * @brief	Get total number of memory deallocation requests
- * @return	total number of memory deallocation requests
+ * @return	total number of memory deallocation requests (the default heap)
  */
 unsigned long Allocator_totalDeallocationRequests(void)
 {
-	return totalDeallocationRequests_;
+	return (allocator_) ? allocator_->stats.deallocationRequests : 0;
+}
+
+/**
+ * @brief	Get the statistics of the default heap
+ * @param	stats			pointer to the snapshot buffer
+ * @return	none
+ */
+void Allocator_statistics(struct AllocatorStatistics* const stats)
+{
+	Allocator_heapStatistics(NULL, stats);
+}
+
+/**
+ * @brief	Reset the peak values of the default heap
+ * @return	none
+ */
+void Allocator_resetPeak(void)
+{
+	Allocator_heapResetPeak(NULL);
+}
+
+/**
+ * @brief	Get the name of a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @return	the name
+ */
+const char* Allocator_heapName(const Allocator* const heap)
+{
+	const struct Allocator* const self = (heap) ? heap : allocator_;
+	ASSERT_(self != NULL);
+
+	return self->name;
+}
+
+/**
+ * @brief	Get the statistics of a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @param	stats			pointer to the snapshot buffer
+ * @return	none
+ *
+ * @note A plain copy: cheap enough to be called periodically in production.
+ */
+void Allocator_heapStatistics(const Allocator* const heap, struct AllocatorStatistics* const stats)
+{
+	const struct Allocator* const self = (heap) ? heap : allocator_;
+	ASSERT_(self != NULL);
+
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+	*stats = self->stats;
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+}
+
+/**
+ * @brief	Reset the peak values of a heap to the live values
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @return	none
+ */
+void Allocator_heapResetPeak(Allocator* const heap)
+{
+	struct Allocator* const self = heap_or_default(heap);
+	ASSERT_(self != NULL);
+
+	const lib_critical_section_t context = (self->isrSafe) ? lib_critical_section_enter() : 0;
+	self->stats.peakBytes = self->stats.liveBytes;
+	self->stats.peakBlocks = self->stats.liveBlocks;
+	if (self->isrSafe) { lib_critical_section_exit(context); }
+}
+
+/**
+ * @brief	Select the ISR-safe mode of a heap
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @param	isr_safe		mask interrupts in allocation and deallocation
+ * @return	none
+ *
+ * @note Allows allocating in an ISR and deallocating in the main loop (or the
+ *       other way). Interrupts stay masked for one backend call: bounded for
+ *       the pool and TLSF backends, but not for the std backend (malloc).
+ * @attention Select before the heap is shared with an ISR.
+ */
+void Allocator_setIsrSafe(Allocator* const heap, const bool isr_safe)
+{
+	struct Allocator* const self = heap_or_default(heap);
+	ASSERT_(self != NULL);
+
+	self->isrSafe = isr_safe;
+}
+
+/**
+ * @brief	Is the heap in the ISR-safe mode
+ * @param	heap			Allocator* (NULL: the default heap)
+ * @retval	true			ISR-safe
+ * @retval	false			not ISR-safe
+ */
+bool Allocator_isrSafe(const Allocator* const heap)
+{
+	const struct Allocator* const self = (heap) ? heap : allocator_;
+	ASSERT_(self != NULL);
+
+	return self->isrSafe;
 }
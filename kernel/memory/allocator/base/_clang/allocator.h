@@ -17,19 +17,83 @@
 #ifndef SDPSES_KERNEL_MEMORY_ALLOCATOR_H_INCLUDED_
 #define SDPSES_KERNEL_MEMORY_ALLOCATOR_H_INCLUDED_
 
+#include <stdbool.h>
 #include <stddef.h>
 
+#include "system_parameter_definition.h"
+
 #ifdef __cplusplus
 #include <new>
 extern "C" {
 #endif
 
+/*! @note Alignment for cache-line aligned buffers (0: no data cache) */
+#if defined(MPU_DCACHE_LINE_SIZE) && (MPU_DCACHE_SIZE > 0)
+enum { kALLOCATOR_CACHE_LINE_SIZE = MPU_DCACHE_LINE_SIZE };
+#else
+enum { kALLOCATOR_CACHE_LINE_SIZE = 0 };
+#endif
+
+/*! @note A heap (an allocator instance). NULL designates the default heap. */
+struct Allocator;
+typedef struct Allocator Allocator;
+
+enum { kALLOCATOR_HISTOGRAM_SIZE = 16 };
+
+/**
+ * @enum	AllocatorPlacement
+ * @brief	Placement hint (the speed tier of the memory region)
+ * @note	Without a backend of several regions, every placement is the default heap.
+ */
+enum AllocatorPlacement {
+	kALLOCATOR_PLACEMENT_ANY = 0,
+	kALLOCATOR_PLACEMENT_FAST,		/*!< e.g. on-chip RAM (ISR-side buffers) */
+	kALLOCATOR_PLACEMENT_BULK,		/*!< e.g. external SDRAM (large buffers) */
+	kALLOCATOR_PLACEMENT_NUM
+};
+
+/**
+ * @struct	AllocatorStatistics
+ * @brief	Allocator statistics snapshot
+ * @note	Bytes are as occupied by the backend (e.g. rounded up to the block size).
+ *			Without the backend's blockSize, requested sizes are counted and
+ *			deallocations leave liveBytes unchanged.
+ */
+struct AllocatorStatistics {
+	size_t liveBytes;
+	size_t peakBytes;
+	size_t liveBlocks;
+	size_t peakBlocks;
+	unsigned long allocationRequests;	/*!< succeeded */
+	unsigned long deallocationRequests;
+	unsigned long failedRequests;
+	unsigned long sizeHistogram[kALLOCATOR_HISTOGRAM_SIZE];	/*!< [n]: requested size < 2^(n+1), [last]: the rest */
+};
+
 void* Allocator_allocate(size_t size);
+void* Allocator_allocateAligned(size_t size, size_t alignment);
 void Allocator_deallocate(void* ptr);
 
 unsigned long Allocator_totalAllocationRequests(void);
 unsigned long Allocator_totalDeallocationRequests(void);
 
+void Allocator_statistics(struct AllocatorStatistics* stats);
+void Allocator_resetPeak(void);
+
+Allocator* Allocator_defaultHeap(void);
+Allocator* Allocator_placementHeap(enum AllocatorPlacement placement);
+
+void* Allocator_allocateFrom(Allocator* heap, size_t size);
+void* Allocator_allocateAlignedFrom(Allocator* heap, size_t size, size_t alignment);
+void Allocator_deallocateFrom(Allocator* heap, void* ptr);
+
+const char* Allocator_heapName(const Allocator* heap);
+void Allocator_heapStatistics(const Allocator* heap, struct AllocatorStatistics* stats);
+void Allocator_heapResetPeak(Allocator* heap);
+
+void Allocator_setIsrSafe(Allocator* heap, bool isr_safe);
+bool Allocator_isrSafe(const Allocator* heap);
+
 #ifdef __cplusplus
 }
 #endif
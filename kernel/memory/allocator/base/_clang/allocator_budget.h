@@ -0,0 +1,62 @@
+/**
+ * @file	allocator_budget.h
+ * @brief	build-time memory budget of the allocator users
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ *
+ * @note Each component declares the worst-case footprint of its allocations
+ *       as a macro (e.g. FIXED_QUEUE8_BUDGET_(), MB_UART_BUDGET_()). A product
+ *       lists them as BUDGET(name, bytes) and checks the total against its pool:
+ * @code
+ * #define ALLOCATOR_BUDGETS(BUDGET) \
+ * 	BUDGET(uart0, MB_UART_BUDGET_(256, 256)) \
+ * 	BUDGET(log, FIXED_QUEUE8_BUDGET_(1024))
+ *
+ * ALLOCATOR_BUDGET_CHECK_(ALLOCATOR_BUDGETS, kONLY_ONCE_ALLOCATOR_SIZE_MAX);
+ * @endcode
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_ALLOCATOR_BUDGET_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_ALLOCATOR_BUDGET_H_INCLUDED_
+
+/*! @note Block alignment of the backend (only-once and TLSF: 8) */
+#if !defined(ALLOCATOR_BUDGET_ALIGNMENT)
+#define ALLOCATOR_BUDGET_ALIGNMENT			8
+#endif
+
+/*! @note Header bytes per block of the backend (only-once: 0, TLSF: 2 pointers) */
+#if !defined(ALLOCATOR_BUDGET_BLOCK_OVERHEAD)
+#define ALLOCATOR_BUDGET_BLOCK_OVERHEAD		0
+#endif
+
+/*! @brief	Bytes a block of the size occupies in the pool */
+#define ALLOCATOR_BUDGET_BLOCK_(size) \
+	((((size) + (ALLOCATOR_BUDGET_ALIGNMENT - 1)) / ALLOCATOR_BUDGET_ALIGNMENT) * ALLOCATOR_BUDGET_ALIGNMENT \
+	+ ALLOCATOR_BUDGET_BLOCK_OVERHEAD)
+
+/*! @brief	Bytes an aligned block of the size occupies in the pool (incl. the padding) */
+#define ALLOCATOR_BUDGET_ALIGNED_BLOCK_(size, alignment) \
+	(ALLOCATOR_BUDGET_BLOCK_(size) + (alignment))
+
+/*! @brief	Total of a budget list: LIST(BUDGET) with BUDGET(name, bytes) */
+#define ALLOCATOR_BUDGET_ITEM_(name, bytes)		+ (bytes)
+#define ALLOCATOR_BUDGET_TOTAL_(LIST)			(0 LIST(ALLOCATOR_BUDGET_ITEM_))
+
+/*! @brief	Build-time assertion (C99 and C++03: a negative array size fails) */
+#define ALLOCATOR_BUDGET_STATIC_ASSERT_(cond, tag) \
+	typedef char allocator_budget_assertion_##tag[(cond) ? 1 : -1]
+
+/*! @brief	Fails to build if the total of the budget list exceeds the pool size */
+#define ALLOCATOR_BUDGET_CHECK_(LIST, pool_size) \
+	ALLOCATOR_BUDGET_STATIC_ASSERT_(ALLOCATOR_BUDGET_TOTAL_(LIST) <= (pool_size), budget_exceeds_the_pool)
+
+#endif /* SDPSES_KERNEL_MEMORY_ALLOCATOR_BUDGET_H_INCLUDED_ */
@@ -17,14 +17,35 @@
 #ifndef SDPSES_KERNEL_MEMORY_ALLOCATOR_PRIVATE_H_INCLUDED_
 #define SDPSES_KERNEL_MEMORY_ALLOCATOR_PRIVATE_H_INCLUDED_
 
+#include <stdbool.h>
+
 #include "allocator.h"
 
+/**
+ * @struct	Allocator
+ * @brief	Allocator backend (a heap)
+ * @note	allocateAligned takes a power-of-two alignment; its blocks are
+ *			released by deallocate.
+ * @note	blockSize returns the bytes a block occupies (NULL: unknown), so that
+ *			the live/peak statistics can account deallocations.
+ * @note	A backend embeds this as the first member of its heap instance and
+ *			casts self back.
+ */
 struct Allocator {
-	void* (*allocate)(size_t size);
-	void (*deallocate)(void* ptr);
+	void* (*allocate)(struct Allocator* self, size_t size);
+	void* (*allocateAligned)(struct Allocator* self, size_t size, size_t alignment);
+	void (*deallocate)(struct Allocator* self, void* ptr);
+	size_t (*blockSize)(const struct Allocator* self, const void* ptr);
+
+	const char* name;
+	bool isrSafe;		/*!< mask interrupts around the backend and the statistics */
+	struct AllocatorStatistics stats;
 };
 
-void Allocator_initialize(const struct Allocator* allocator);
+void Allocator_initialize(struct Allocator* allocator);
 void Allocator_terminate(void);
 
+void Allocator_initializeHeap(struct Allocator* heap, const char* name);
+void Allocator_setPlacementHeap(enum AllocatorPlacement placement, struct Allocator* heap);
+
 #endif /* SDPSES_KERNEL_MEMORY_ALLOCATOR_PRIVATE_H_INCLUDED_ */
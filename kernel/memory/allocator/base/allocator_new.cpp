@@ -0,0 +1,151 @@
+/**
+ * @file	allocator_new.cpp
+ * @brief	global operator new/delete over Allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ *
+ * @note With USE_ORIGINAL_ALLOCATOR_NEW_, every new/delete goes to the default
+ *       heap, so C++ objects show up in the heap statistics.
+ * @attention Initialize the backend before the first new (e.g. before
+ *       constructing static objects that allocate).
+ */
+
+#if defined(USE_ORIGINAL_ALLOCATOR_NEW_)
+
+#include <cstddef>
+#include <new>
+
+#include "allocator.h"
+#include "lib_debug.h"
+
+#if (__cplusplus >= 201103L)
+#  define ALLOCATOR_NEW_THROW_
+#  define ALLOCATOR_NEW_NOTHROW_	noexcept
+#else
+#  define ALLOCATOR_NEW_THROW_		throw(std::bad_alloc)
+#  define ALLOCATOR_NEW_NOTHROW_	throw()
+#endif
+
+namespace {
+
+void* allocate(const std::size_t size)
+{
+	void* const ptr = Allocator_allocate((size) ? size : 1);
+	if (!ptr) {
+#if defined(__EXCEPTIONS)
+		throw std::bad_alloc();
+#else
+		FATAL_("Cannot allocate memory\r\n");
+		DYNAMIC_STOP_();
+#endif
+	}
+
+	return ptr;
+}
+
+} /* namespace */
+
+void* operator new(const std::size_t size) ALLOCATOR_NEW_THROW_
+{
+	return allocate(size);
+}
+
+void* operator new[](const std::size_t size) ALLOCATOR_NEW_THROW_
+{
+	return allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) ALLOCATOR_NEW_NOTHROW_
+{
+	return Allocator_allocate((size) ? size : 1);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) ALLOCATOR_NEW_NOTHROW_
+{
+	return Allocator_allocate((size) ? size : 1);
+}
+
+void operator delete(void* const ptr) ALLOCATOR_NEW_NOTHROW_
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete[](void* const ptr) ALLOCATOR_NEW_NOTHROW_
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete(void* const ptr, const std::nothrow_t&) ALLOCATOR_NEW_NOTHROW_
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete[](void* const ptr, const std::nothrow_t&) ALLOCATOR_NEW_NOTHROW_
+{
+	Allocator_deallocate(ptr);
+}
+
+#if (__cplusplus >= 201402L)
+void operator delete(void* const ptr, const std::size_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete[](void* const ptr, const std::size_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+#endif
+
+#if (__cplusplus >= 201703L)
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+	void* const ptr = Allocator_allocateAligned((size) ? size : 1, static_cast<std::size_t>(alignment));
+	if (!ptr) {
+#if defined(__EXCEPTIONS)
+		throw std::bad_alloc();
+#else
+		FATAL_("Cannot allocate memory\r\n");
+		DYNAMIC_STOP_();
+#endif
+	}
+
+	return ptr;
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+	return ::operator new(size, alignment);
+}
+
+void operator delete(void* const ptr, const std::align_val_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete[](void* const ptr, const std::align_val_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete(void* const ptr, const std::size_t, const std::align_val_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+
+void operator delete[](void* const ptr, const std::size_t, const std::align_val_t) noexcept
+{
+	Allocator_deallocate(ptr);
+}
+#endif
+
+#endif /* USE_ORIGINAL_ALLOCATOR_NEW_ */
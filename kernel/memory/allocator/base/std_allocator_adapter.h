@@ -0,0 +1,86 @@
+/**
+ * @file	std_allocator_adapter.h
+ * @brief	standard allocator adapter
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_STD_ALLOCATOR_ADAPTER_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_STD_ALLOCATOR_ADAPTER_H_INCLUDED_
+
+#include <cstddef>
+
+#include "allocator.h"
+
+namespace sdpses {
+
+namespace memory {
+
+/**
+ * @class	StdAllocatorAdapter
+ * @brief	Standard allocator over Allocator (e.g. std::vector<T, StdAllocatorAdapter<T> >)
+ * @note	Allocates from the given heap (NULL: the default heap), so standard
+ *			containers show up in the heap statistics.
+ * @note	Failure throws std::bad_alloc, or stops with FATAL_ when built
+ *			without exceptions.
+ */
+template <typename T>
+class StdAllocatorAdapter {
+
+public:
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+
+	template <typename U>
+	struct rebind { typedef StdAllocatorAdapter<U> other; };
+
+	StdAllocatorAdapter() throw();
+	explicit StdAllocatorAdapter(::Allocator* heap) throw();
+	StdAllocatorAdapter(const StdAllocatorAdapter& other) throw();
+	template <typename U>
+	StdAllocatorAdapter(const StdAllocatorAdapter<U>& other) throw();
+	~StdAllocatorAdapter() throw();
+
+	pointer allocate(size_type n, const void* hint = 0);
+	void deallocate(pointer p, size_type n);
+	size_type max_size() const throw();
+
+	void construct(pointer p, const T& value);
+	void destroy(pointer p);
+
+	pointer address(reference x) const;
+	const_pointer address(const_reference x) const;
+
+	::Allocator* heap() const throw();
+
+private:
+	::Allocator* heap_;
+};
+
+template <typename T, typename U>
+bool operator==(const StdAllocatorAdapter<T>& lhs, const StdAllocatorAdapter<U>& rhs) throw();
+
+template <typename T, typename U>
+bool operator!=(const StdAllocatorAdapter<T>& lhs, const StdAllocatorAdapter<U>& rhs) throw();
+
+} /* namespace memory */
+
+} /* namespace sdpses */
+
+#include "std_allocator_adapter_inline.h"
+
+#endif /* SDPSES_KERNEL_MEMORY_STD_ALLOCATOR_ADAPTER_H_INCLUDED_ */
@@ -0,0 +1,198 @@
+/**
+ * @file	std_allocator_adapter_inline.h
+ * @brief	standard allocator adapter inline
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/*! @note The include guard is not required. */
+
+#include <new>
+
+#include "lib_debug.h"
+
+namespace sdpses {
+
+namespace memory {
+
+/**
+ * @brief	Constructor (the default heap)
+ */
+template <typename T>
+inline StdAllocatorAdapter<T>::StdAllocatorAdapter() throw()
+	: heap_(NULL)
+{
+}
+
+/**
+ * @brief	Constructor
+ * @param	heap			heap (NULL: the default heap)
+ */
+template <typename T>
+inline StdAllocatorAdapter<T>::StdAllocatorAdapter(::Allocator* const heap) throw()
+	: heap_(heap)
+{
+}
+
+/**
+ * @brief	Copy constructor
+ * @param	other			StdAllocatorAdapter
+ */
+template <typename T>
+inline StdAllocatorAdapter<T>::StdAllocatorAdapter(const StdAllocatorAdapter& other) throw()
+	: heap_(other.heap())
+{
+}
+
+/**
+ * @brief	Converting constructor (rebind)
+ * @param	other			StdAllocatorAdapter
+ */
+template <typename T>
+template <typename U>
+inline StdAllocatorAdapter<T>::StdAllocatorAdapter(const StdAllocatorAdapter<U>& other) throw()
+	: heap_(other.heap())
+{
+}
+
+/**
+ * @brief	Destructor
+ */
+template <typename T>
+inline StdAllocatorAdapter<T>::~StdAllocatorAdapter() throw()
+{
+}
+
+/**
+ * @brief	Allocates storage for n objects
+ * @param	n				the number of objects
+ * @param	hint			unused
+ * @return	storage (not constructed)
+ */
+template <typename T>
+inline typename StdAllocatorAdapter<T>::pointer StdAllocatorAdapter<T>::allocate(const size_type n, const void* const hint)
+{
+	(void)hint;
+
+	void* const p = (n <= max_size()) ? Allocator_allocateAlignedFrom(heap_, (sizeof(T) * n), __alignof__(T)) : NULL;
+	if (!p) {
+#if defined(__EXCEPTIONS)
+		throw std::bad_alloc();
+#else
+		FATAL_("Cannot allocate memory\r\n");
+		DYNAMIC_STOP_();
+#endif
+	}
+
+	return static_cast<pointer>(p);
+}
+
+/**
+ * @brief	Deallocates storage
+ * @param	p				storage returned by allocate()
+ * @param	n				the number of objects
+ * @return	none
+ */
+template <typename T>
+inline void StdAllocatorAdapter<T>::deallocate(const pointer p, const size_type n)
+{
+	(void)n;
+
+	Allocator_deallocateFrom(heap_, p);
+}
+
+/**
+ * @brief	Returns the maximum number of objects
+ * @return	the maximum number of objects
+ */
+template <typename T>
+inline typename StdAllocatorAdapter<T>::size_type StdAllocatorAdapter<T>::max_size() const throw()
+{
+	return (static_cast<size_type>(-1) / sizeof(T));
+}
+
+/**
+ * @brief	Constructs an object
+ * @param	p				storage
+ * @param	value			initial value
+ * @return	none
+ */
+template <typename T>
+inline void StdAllocatorAdapter<T>::construct(const pointer p, const T& value)
+{
+	new(static_cast<void*>(p)) T(value);
+}
+
+/**
+ * @brief	Destroys an object
+ * @param	p				object
+ * @return	none
+ */
+template <typename T>
+inline void StdAllocatorAdapter<T>::destroy(const pointer p)
+{
+	p->~T();
+}
+
+/**
+ * @brief	Returns the address
+ * @param	x				object
+ * @return	the address
+ */
+template <typename T>
+inline typename StdAllocatorAdapter<T>::pointer StdAllocatorAdapter<T>::address(reference x) const
+{
+	return &x;
+}
+
+/**
+ * @brief	Returns the address
+ * @param	x				object
+ * @return	the address
+ */
+template <typename T>
+inline typename StdAllocatorAdapter<T>::const_pointer StdAllocatorAdapter<T>::address(const_reference x) const
+{
+	return &x;
+}
+
+/**
+ * @brief	Returns the heap
+ * @return	the heap (NULL: the default heap)
+ */
+template <typename T>
+inline ::Allocator* StdAllocatorAdapter<T>::heap() const throw()
+{
+	return heap_;
+}
+
+/**
+ * @brief	Equal (the storage of one can be deallocated by the other)
+ */
+template <typename T, typename U>
+inline bool operator==(const StdAllocatorAdapter<T>& lhs, const StdAllocatorAdapter<U>& rhs) throw()
+{
+	return (lhs.heap() == rhs.heap());
+}
+
+/**
+ * @brief	Not equal
+ */
+template <typename T, typename U>
+inline bool operator!=(const StdAllocatorAdapter<T>& lhs, const StdAllocatorAdapter<U>& rhs) throw()
+{
+	return !(lhs == rhs);
+}
+
+} /* namespace memory */
+
+} /* namespace sdpses */
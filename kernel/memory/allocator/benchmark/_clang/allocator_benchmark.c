@@ -0,0 +1,421 @@
+/**
+ * @file	allocator_benchmark.c
+ * @brief	host benchmark of the allocator backends
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ *
+ * @note Runs the same workloads on each backend and reports the latency
+ *       (mean, p99 and worst case) of allocation and deallocation, the failed
+ *       requests and the peak pool utilization. The fragmentation workload
+ *       also reports the utilization at which the first request failed.
+ * @note Host build only (neither __NIOS2__ nor __MICROBLAZE__): the free run
+ *       counter runs on CclockTimer (the host monotonic clock). From the root
+ *       of the repository, with lib_assert.h and lib_debug.h in $LIB:
+ * @code
+ * A=kernel/memory/allocator; D=device
+ * cc -std=c99 -O2 -DNDEBUG -I$LIB -Ilibutl -Ienvironment \
+ *    -I$A/base/_clang -I$A/standard/_clang -I$A/only_once/_clang -I$A/pool/_clang \
+ *    -I$A/tlsf/_clang -I$A/buddy/_clang -I$D/free_run_counter/_clang \
+ *    -I$D/timer/base/_clang -I$D/timer/cclock_timer/_clang \
+ *    $A/benchmark/_clang/allocator_benchmark.c $A/base/_clang/allocator.c \
+ *    $A/standard/_clang/std_allocator.c $A/only_once/_clang/only_once_allocator.c \
+ *    $A/pool/_clang/pool_allocator.c $A/tlsf/_clang/tlsf_allocator.c \
+ *    $A/buddy/_clang/buddy_allocator.c $D/free_run_counter/_clang/free_run_counter.c \
+ *    $D/free_run_counter/_clang/frc_timer_factory.c $D/timer/base/_clang/timer.c \
+ *    $D/timer/cclock_timer/_clang/cclock_timer.c -o allocator_benchmark
+ * @endcode
+ * @note The pool sizes are those of the *_cfg.h files: benchmark the
+ *       configuration of the product line.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "allocator.h"
+#include "std_allocator.h"
+#include "only_once_allocator.h"
+#include "pool_allocator.h"
+#include "tlsf_allocator.h"
+#include "buddy_allocator.h"
+#include "free_run_counter.h"
+
+#if defined(__NIOS2__) || defined(__MICROBLAZE__)
+#error "allocator_benchmark.c is a host program."
+#endif
+
+enum {
+	kOPERATION_NUM = 20000,		/*!< timed allocations per workload */
+	kWINDOW_SIZE = 16,			/*!< live blocks of the churn, mixed, LIFO and FIFO workloads */
+	kSLOT_NUM = 1024,			/*!< live blocks of the fragmentation workload (at most) */
+	kPHASE_NUM = 4,				/*!< the fragmentation workload is reported per phase */
+	kCALIBRATION_NUM = 1000
+};
+
+/**
+ * @struct	Backend
+ * @brief	Backend under test
+ */
+struct Backend {
+	const char* name;
+	void (*initialize)(void);
+	void (*terminate)(void);
+	size_t (*capacity)(void);			/*!< pool size right after initialize (NULL: unbounded) */
+	bool deallocatable;					/*!< false: the blocks are released by rewinding */
+};
+
+/**
+ * @struct	Latency
+ * @brief	Latency samples of one operation [ns]
+ */
+struct Latency {
+	uint32_t samples[kOPERATION_NUM];
+	size_t count;
+};
+
+/**
+ * @struct	Run
+ * @brief	One workload on one backend
+ */
+struct Run {
+	const struct Backend* backend;
+	Allocator* heap;
+	size_t capacity;	/*!< 0: unbounded */
+	struct Latency allocation;
+	struct Latency deallocation;
+	unsigned long failedRequests;
+	size_t peakBytes;
+};
+
+static const FreeRunCounter* freeRunCounter_;
+static uint32_t overheadNsec_;	/*!< of a measurement without an operation */
+static uint32_t random_ = 2463534242UL;
+
+static struct Run run_;
+static void* slots_[kSLOT_NUM];
+static size_t slotSizes_[kSLOT_NUM];
+
+static OnlyOnceAllocatorMark onlyOnceMark_;
+
+/*! @note BuddyAllocator_allocatableSizeMax() is the largest block: sum the free blocks instead. */
+static size_t buddy_capacity(void)
+{
+	size_t capacity = 0;
+	for (size_t order = BuddyAllocator_minOrder(); order <= BuddyAllocator_maxOrder(); order++) {
+		capacity += BuddyAllocator_freeBlockNum(order) << order;
+	}
+
+	return capacity;
+}
+
+static const struct Backend kBACKENDS[] = {
+	{ "std",		StdAllocator_initialize,		StdAllocator_terminate,		NULL,									true },
+	{ "only_once",	OnlyOnceAllocator_initialize,	OnlyOnceAllocator_terminate,	OnlyOnceAllocator_allocatableSizeMax,	false },
+	{ "pool",		PoolAllocator_initialize,		PoolAllocator_terminate,		PoolAllocator_allocatableSizeMax,		true },
+	{ "tlsf",		TlsfAllocator_initialize,		TlsfAllocator_terminate,		TlsfAllocator_allocatableSizeMax,		true },
+	{ "buddy",		BuddyAllocator_initialize,		BuddyAllocator_terminate,		buddy_capacity,							true }
+};
+
+/*! @note xorshift32: the same sequence on every backend */
+static inline uint32_t next_random(void) {
+	random_ ^= random_ << 13;
+	random_ ^= random_ >> 17;
+	random_ ^= random_ << 5;
+	return random_;
+}
+
+/*! @note Mostly small blocks: 16 to 511 bytes, twice as likely per halving. */
+static inline size_t mixed_size(void) {
+	const uint32_t r = next_random();
+	const unsigned int shift = (r & 0x1) ? 0 : (r & 0x2) ? 1 : (r & 0x4) ? 2 : (r & 0x8) ? 3 : 4;
+	return ((size_t)16 << shift) + ((r >> 8) % ((size_t)16 << shift));
+}
+
+/*! @note Wider spread for the fragmentation workload: 8 to 1023 bytes (within every backend). */
+static inline size_t fragmentation_size(void) {
+	const uint32_t r = next_random();
+	const unsigned int shift = (r >> 4) % 7;
+	return ((size_t)8 << shift) + ((r >> 8) % ((size_t)8 << shift));
+}
+
+static int compare_uint32(const void* const a, const void* const b) {
+	const uint32_t x = *(const uint32_t*)a;
+	const uint32_t y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+static inline uint32_t measured_nsec(const uint32_t start_count, const uint32_t end_count) {
+	const uint32_t nsec = freeRunCounter_->measureDurationNsec(start_count, end_count);
+	return (nsec > overheadNsec_) ? (nsec - overheadNsec_) : 0;
+}
+
+static inline void record(struct Latency* const latency, const uint32_t nsec) {
+	if (latency->count < kOPERATION_NUM) { latency->samples[latency->count++] = nsec; }
+}
+
+/*! @note The smallest duration of an empty measurement is subtracted from every sample. */
+static void calibrate(void)
+{
+	uint32_t smallest = UINT32_MAX;
+	for (int i = 0; i < kCALIBRATION_NUM; i++) {
+		const uint32_t start = freeRunCounter_->now();
+		const uint32_t end = freeRunCounter_->now();
+		const uint32_t nsec = freeRunCounter_->measureDurationNsec(start, end);
+		if (nsec < smallest) { smallest = nsec; }
+	}
+	overheadNsec_ = smallest;
+}
+
+static void* timed_allocate(struct Run* const run, const size_t size)
+{
+	const uint32_t start = freeRunCounter_->now();
+	void* const ptr = Allocator_allocateFrom(run->heap, size);
+	const uint32_t end = freeRunCounter_->now();
+
+	record(&run->allocation, measured_nsec(start, end));
+	if (!ptr) { run->failedRequests++; }
+
+	return ptr;
+}
+
+static void timed_deallocate(struct Run* const run, void* const ptr)
+{
+	if (!ptr) { return; }
+
+	const uint32_t start = freeRunCounter_->now();
+	Allocator_deallocateFrom(run->heap, ptr);
+	const uint32_t end = freeRunCounter_->now();
+
+	record(&run->deallocation, measured_nsec(start, end));
+}
+
+/*! @note Releases the window: each block if deallocatable, otherwise by rewinding (not timed). */
+static void release_window(struct Run* const run, void* window[], const size_t count, const bool lifo)
+{
+	if (!run->backend->deallocatable) {
+		OnlyOnceAllocator_release(onlyOnceMark_);
+	} else {
+		for (size_t i = 0; i < count; i++) {
+			const size_t index = (lifo) ? (count - 1 - i) : i;
+			timed_deallocate(run, window[index]);
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		window[i] = NULL;
+	}
+}
+
+/*! @note Allocate and free one 64-byte block at a time. */
+static void workload_churn(struct Run* const run)
+{
+	for (int i = 0; i < kOPERATION_NUM; i++) {
+		slots_[0] = timed_allocate(run, 64);
+		release_window(run, slots_, 1, false);
+	}
+}
+
+/*! @note Replace a random block of the window by one of a random size. */
+static void workload_mixed(struct Run* const run)
+{
+	for (int i = 0; i < kOPERATION_NUM; i++) {
+		const size_t index = next_random() % kWINDOW_SIZE;
+		if (run->backend->deallocatable) {
+			timed_deallocate(run, slots_[index]);
+		} else if ((i % kWINDOW_SIZE) == 0) {
+			release_window(run, slots_, kWINDOW_SIZE, false);
+		}
+		slots_[index] = timed_allocate(run, mixed_size());
+	}
+	release_window(run, slots_, kWINDOW_SIZE, false);
+}
+
+/*! @note Fill the window, then free it in reverse order (e.g. nested scopes). */
+static void workload_lifo(struct Run* const run)
+{
+	for (int i = 0; i < kOPERATION_NUM; i += kWINDOW_SIZE) {
+		for (size_t n = 0; n < kWINDOW_SIZE; n++) {
+			slots_[n] = timed_allocate(run, mixed_size());
+		}
+		release_window(run, slots_, kWINDOW_SIZE, true);
+	}
+}
+
+/*! @note Fill the window, then free it in allocation order (e.g. message queues). */
+static void workload_fifo(struct Run* const run)
+{
+	for (int i = 0; i < kOPERATION_NUM; i += kWINDOW_SIZE) {
+		for (size_t n = 0; n < kWINDOW_SIZE; n++) {
+			slots_[n] = timed_allocate(run, mixed_size());
+		}
+		release_window(run, slots_, kWINDOW_SIZE, false);
+	}
+}
+
+/**
+ * @brief	Fragmentation over time
+ * @param	run				Run
+ * @return	none
+ *
+ * @note Random allocations (55%) and deallocations of random live blocks
+ *       keep the pool close to full. Per phase, the mean utilization and
+ *       the failed requests are reported; over the whole run, the
+ *       utilization at the first failure (lower: more fragmentation).
+ */
+static void workload_fragmentation(struct Run* const run)
+{
+	const size_t capacity = run->capacity;
+	const int phaseLength = kOPERATION_NUM / kPHASE_NUM;
+	size_t liveNum = 0;
+	size_t liveBytes = 0;
+	bool failed = false;
+
+	printf("    phase  mean util[%%]  failed\n");
+
+	for (int phase = 0; phase < kPHASE_NUM; phase++) {
+		const unsigned long failedBefore = run->failedRequests;
+		unsigned long long utilizationSum = 0;
+
+		for (int i = 0; i < phaseLength; i++) {
+			const bool allocation = ((next_random() % 100) < 55) || (liveNum == 0);
+			if (allocation && (liveNum < kSLOT_NUM)) {
+				const size_t size = fragmentation_size();
+				void* const ptr = timed_allocate(run, size);
+				if (ptr) {
+					slots_[liveNum] = ptr;
+					slotSizes_[liveNum] = size;
+					liveNum++;
+					liveBytes += size;
+				} else if (!failed) {
+					failed = true;
+					if (capacity) {
+						printf("    first failure at %u%% utilization (%lu bytes requested)\n",
+								(unsigned int)((liveBytes * 100) / capacity), (unsigned long)size);
+					}
+				}
+			} else if (liveNum > 0) {
+				const size_t index = next_random() % liveNum;
+				timed_deallocate(run, slots_[index]);
+				liveBytes -= slotSizes_[index];
+				liveNum--;
+				slots_[index] = slots_[liveNum];
+				slotSizes_[index] = slotSizes_[liveNum];
+			}
+			utilizationSum += (capacity) ? ((liveBytes * 100) / capacity) : 0;
+		}
+
+		if (capacity) {
+			printf("    %5d  %12u  %6lu\n", phase,
+					(unsigned int)(utilizationSum / (unsigned long long)phaseLength), run->failedRequests - failedBefore);
+		} else {
+			printf("    %5d  %12s  %6lu\n", phase, "-", run->failedRequests - failedBefore);
+		}
+	}
+
+	for (size_t i = 0; i < liveNum; i++) {
+		timed_deallocate(run, slots_[i]);
+	}
+}
+
+/*! @note mean, p99 and worst case [ns] ("-": no samples) */
+static void print_latency(struct Latency* const latency)
+{
+	if (latency->count == 0) {
+		printf(" %7s %7s %8s", "-", "-", "-");
+		return;
+	}
+
+	qsort(latency->samples, latency->count, sizeof(latency->samples[0]), compare_uint32);
+
+	unsigned long long sum = 0;
+	for (size_t i = 0; i < latency->count; i++) {
+		sum += latency->samples[i];
+	}
+	const size_t p99 = ((latency->count * 99) + (100 - 1)) / 100;
+
+	printf(" %7lu %7lu %8lu",
+			(unsigned long)(sum / latency->count),
+			(unsigned long)latency->samples[p99 - 1],
+			(unsigned long)latency->samples[latency->count - 1]);
+}
+
+static void run_workload(const struct Backend* const backend, const char* const name,
+		void (*const workload)(struct Run* run), const bool needs_deallocation)
+{
+	if (needs_deallocation && !backend->deallocatable) {
+		printf("%-10s %-14s (not applicable: no deallocation)\n", backend->name, name);
+		return;
+	}
+
+	backend->initialize();
+	if (!backend->deallocatable) { onlyOnceMark_ = OnlyOnceAllocator_mark(); }
+
+	struct Run* const run = &run_;
+	run->backend = backend;
+	run->heap = Allocator_defaultHeap();
+	run->capacity = (backend->capacity) ? backend->capacity() : 0;
+	run->allocation.count = 0;
+	run->deallocation.count = 0;
+	run->failedRequests = 0;
+	random_ = 2463534242UL;
+	for (size_t i = 0; i < kSLOT_NUM; i++) {
+		slots_[i] = NULL;
+	}
+
+	if (workload == workload_fragmentation) { printf("%-10s %s\n", backend->name, name); }
+
+	Allocator_heapResetPeak(run->heap);
+	workload(run);
+
+	struct AllocatorStatistics stats;
+	Allocator_heapStatistics(run->heap, &stats);
+	run->peakBytes = stats.peakBytes;
+
+	printf("%-10s %-14s", backend->name, name);
+	print_latency(&run->allocation);
+	print_latency(&run->deallocation);
+	printf(" %7lu", run->failedRequests);
+	if (run->capacity) {
+		printf(" %9u\n", (unsigned int)((run->peakBytes * 100) / run->capacity));
+	} else {
+		printf(" %9s\n", "-");
+	}
+
+	backend->terminate();
+}
+
+int main(void)
+{
+	/*! @note The counter instance is taken from the std backend, apart from the heaps under test. */
+	StdAllocator_initialize();
+	freeRunCounter_ = FreeRunCounter_getInstance();
+	calibrate();
+
+	printf("allocator benchmark: %d allocations per workload, measurement overhead %lu ns\n\n",
+			kOPERATION_NUM, (unsigned long)overheadNsec_);
+	printf("%-10s %-14s %25s %25s %7s %9s\n", "", "", "allocation [ns]", "deallocation [ns]", "", "peak");
+	printf("%-10s %-14s %7s %7s %8s %7s %7s %8s %7s %9s\n", "backend", "workload",
+			"mean", "p99", "max", "mean", "p99", "max", "failed", "util[%]");
+
+	for (size_t i = 0; i < (sizeof(kBACKENDS) / sizeof(kBACKENDS[0])); i++) {
+		const struct Backend* const backend = &kBACKENDS[i];
+		run_workload(backend, "churn", workload_churn, false);
+		run_workload(backend, "mixed", workload_mixed, false);
+		run_workload(backend, "lifo", workload_lifo, false);
+		run_workload(backend, "fifo", workload_fifo, false);
+		run_workload(backend, "fragmentation", workload_fragmentation, true);
+		printf("\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,301 @@
+/**
+ * @file	buddy_allocator.c
+ * @brief	buddy allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "allocator_private.h"
+#include "buddy_allocator.h"
+#include "buddy_allocator_cfg.h"
+#include "lib_assert.h"
+
+/**
+ * @struct	FreeBlock
+ * @brief	Links stored in a free block
+ */
+struct FreeBlock {
+	struct FreeBlock* next;
+	struct FreeBlock* prev;
+};
+
+enum {
+	kORDER_NUM = (kBUDDY_ALLOCATOR_MAX_ORDER - kBUDDY_ALLOCATOR_MIN_ORDER + 1),
+	kBLOCK_SIZE_MAX = (1 << kBUDDY_ALLOCATOR_MAX_ORDER),
+	kMIN_BLOCK_NUM = (kBUDDY_ALLOCATOR_SIZE_MAX >> kBUDDY_ALLOCATOR_MIN_ORDER),
+	kBLOCK_FREE = 0x80	/*!< flag in blockOrder_ */
+};
+
+static struct Allocator allocator_;
+
+#if defined(BUDDY_ALLOCATOR_MEMORY_POOL_BASE)
+static uint8_t* const memoryPool_ = (uint8_t*)BUDDY_ALLOCATOR_MEMORY_POOL_BASE;
+#else
+static uint8_t memoryPool_[kBUDDY_ALLOCATOR_SIZE_MAX] __attribute__((aligned(kBLOCK_SIZE_MAX)));
+#endif
+
+static struct FreeBlock* freeLists_[kORDER_NUM];
+static size_t freeBlockNum_[kORDER_NUM];
+
+/*! order (| kBLOCK_FREE) of the block starting at each smallest block (other entries are stale) */
+static uint8_t blockOrder_[kMIN_BLOCK_NUM];
+
+static size_t totalAllocatedSize_ = 0;
+
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
+
+/*! @note the smallest order whose block holds size */
+static inline size_t order_of_size(const size_t size) {
+	size_t order = kBUDDY_ALLOCATOR_MIN_ORDER;
+	while (((size_t)1 << order) < size) { order++; }
+	return order;
+}
+
+static inline size_t block_index(const void* const block) {
+	return ((size_t)((const uint8_t*)block - &memoryPool_[0]) >> kBUDDY_ALLOCATOR_MIN_ORDER);
+}
+
+static inline void push_free_block(void* const ptr, const size_t order) {
+	struct FreeBlock* const block = ptr;
+	struct FreeBlock** const head = &freeLists_[order - kBUDDY_ALLOCATOR_MIN_ORDER];
+	block->prev = NULL;
+	block->next = *head;
+	if (*head) { (*head)->prev = block; }
+	*head = block;
+	freeBlockNum_[order - kBUDDY_ALLOCATOR_MIN_ORDER]++;
+	blockOrder_[block_index(block)] = (uint8_t)(order | kBLOCK_FREE);
+}
+
+static inline void remove_free_block(struct FreeBlock* const block, const size_t order) {
+	if (block->next) { block->next->prev = block->prev; }
+	if (block->prev) {
+		block->prev->next = block->next;
+	} else {
+		freeLists_[order - kBUDDY_ALLOCATOR_MIN_ORDER] = block->next;
+	}
+	freeBlockNum_[order - kBUDDY_ALLOCATOR_MIN_ORDER]--;
+	blockOrder_[block_index(block)] = (uint8_t)order;
+}
+
+/**
+ * @brief	Initialize
+ * @return	none
+ */
+void BuddyAllocator_initialize(void)
+{
+	allocator_.allocate = allocate;
+	allocator_.allocateAligned = allocate_aligned;
+	allocator_.deallocate = deallocate;
+	allocator_.blockSize = allocated_size;
+	Allocator_initializeHeap(&allocator_, "buddy");
+	Allocator_initialize(&allocator_);
+
+	ASSERT_((kBUDDY_ALLOCATOR_SIZE_MAX % kBLOCK_SIZE_MAX) == 0);
+	ASSERT_(((uintptr_t)&memoryPool_[0] % kBLOCK_SIZE_MAX) == 0);
+	ASSERT_((int)kBUDDY_ALLOCATOR_MAX_ORDER < (int)kBLOCK_FREE);
+	ASSERT_(((size_t)1 << kBUDDY_ALLOCATOR_MIN_ORDER) >= sizeof(struct FreeBlock));
+
+	for (size_t i = 0; i < kORDER_NUM; i++) {
+		freeLists_[i] = NULL;
+		freeBlockNum_[i] = 0;
+	}
+
+	/* the pool starts as free blocks of the largest order */
+	for (size_t offset = kBUDDY_ALLOCATOR_SIZE_MAX; offset > 0; offset -= kBLOCK_SIZE_MAX) {
+		push_free_block(&memoryPool_[offset - kBLOCK_SIZE_MAX], kBUDDY_ALLOCATOR_MAX_ORDER);
+	}
+
+	totalAllocatedSize_ = 0;
+}
+
+/**
+ * @brief	Terminate
+ * @return	none
+ */
+void BuddyAllocator_terminate(void)
+{
+	totalAllocatedSize_ = 0;
+	Allocator_terminate();
+}
+
+/**
+ * @brief	Get total number of memory allocation requests
+ * @return	total number of memory allocation requests
+ */
+unsigned long BuddyAllocator_totalAllocationRequests(void)
+{
+	return Allocator_totalAllocationRequests();
+}
+
+/**
+ * @brief	Get total number of memory deallocation requests
+ * @return	total number of memory deallocation requests
+ */
+unsigned long BuddyAllocator_totalDeallocationRequests(void)
+{
+	return Allocator_totalDeallocationRequests();
+}
+
+/**
+ * @brief	Get total size of allocated memory
+ * @return	total size of allocated memory (blocks)
+ */
+size_t BuddyAllocator_totalAllocatedSize(void)
+{
+	return totalAllocatedSize_;
+}
+
+/**
+ * @brief	Get total capacity of allocatable memory
+ * @return	total capacity of allocatable memory (a single block)
+ */
+size_t BuddyAllocator_allocatableSizeMax(void)
+{
+	return kBLOCK_SIZE_MAX;
+}
+
+/**
+ * @brief	Get the order of the smallest block
+ * @return	the order (block size = 2^order)
+ */
+size_t BuddyAllocator_minOrder(void)
+{
+	return kBUDDY_ALLOCATOR_MIN_ORDER;
+}
+
+/**
+ * @brief	Get the order of the largest block
+ * @return	the order (block size = 2^order)
+ */
+size_t BuddyAllocator_maxOrder(void)
+{
+	return kBUDDY_ALLOCATOR_MAX_ORDER;
+}
+
+/**
+ * @brief	Get the number of free blocks of an order
+ * @param	order			order [minOrder, maxOrder]
+ * @return	the number of free blocks (0: out of range)
+ */
+size_t BuddyAllocator_freeBlockNum(const size_t order)
+{
+	if ((order < kBUDDY_ALLOCATOR_MIN_ORDER) || (order > kBUDDY_ALLOCATOR_MAX_ORDER)) { return 0; }
+
+	return freeBlockNum_[order - kBUDDY_ALLOCATOR_MIN_ORDER];
+}
+
+/**
+ * @brief	Allocate memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note O(log n): the smallest free order that fits is split in halves.
+ *       A block of 2^order bytes is aligned to 2^order.
+ */
+static void* allocate(struct Allocator* const self, const size_t size)
+{
+	(void)self;
+
+	if (size > kBLOCK_SIZE_MAX) { return NULL; }
+
+	const size_t order = order_of_size(size);
+
+	size_t found = order;
+	while ((found <= kBUDDY_ALLOCATOR_MAX_ORDER) && !freeLists_[found - kBUDDY_ALLOCATOR_MIN_ORDER]) { found++; }
+	if (found > kBUDDY_ALLOCATOR_MAX_ORDER) { return NULL; }
+
+	struct FreeBlock* const block = freeLists_[found - kBUDDY_ALLOCATOR_MIN_ORDER];
+	remove_free_block(block, found);
+
+	/* free the upper halves down to the requested order */
+	while (found > order) {
+		found--;
+		push_free_block((uint8_t*)block + ((size_t)1 << found), found);
+	}
+	blockOrder_[block_index(block)] = (uint8_t)order;
+
+	totalAllocatedSize_ += ((size_t)1 << order);
+
+	return block;
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note Blocks are naturally aligned, so the block is just large enough for both.
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	return allocate(self, ((size > alignment) ? size : alignment));
+}
+
+/**
+ * @brief	Deallocate memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	none
+ *
+ * @note O(log n): merges with the buddy while it is free as a whole.
+ */
+static void deallocate(struct Allocator* const self, void* const ptr)
+{
+	(void)self;
+
+	if (!ptr) { return; }
+
+	ASSERT_(((uint8_t*)ptr >= &memoryPool_[0]) && ((uint8_t*)ptr < &memoryPool_[kBUDDY_ALLOCATOR_SIZE_MAX]));
+	ASSERT_(((size_t)((uint8_t*)ptr - &memoryPool_[0]) % ((size_t)1 << kBUDDY_ALLOCATOR_MIN_ORDER)) == 0);
+
+	size_t order = blockOrder_[block_index(ptr)];
+	ASSERT_((order & kBLOCK_FREE) == 0);
+
+	totalAllocatedSize_ -= ((size_t)1 << order);
+
+	size_t offset = (size_t)((uint8_t*)ptr - &memoryPool_[0]);
+	while (order < kBUDDY_ALLOCATOR_MAX_ORDER) {
+		const size_t buddyOffset = offset ^ ((size_t)1 << order);
+		struct FreeBlock* const buddy = (struct FreeBlock*)&memoryPool_[buddyOffset];
+		if (blockOrder_[block_index(buddy)] != (order | kBLOCK_FREE)) { break; }
+
+		remove_free_block(buddy, order);
+		offset = (offset < buddyOffset) ? offset : buddyOffset;
+		order++;
+	}
+
+	push_free_block(&memoryPool_[offset], order);
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	the block size (2^order)
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)self;
+
+	return ((size_t)1 << blockOrder_[block_index(ptr)]);
+}
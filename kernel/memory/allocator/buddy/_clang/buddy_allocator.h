@@ -0,0 +1,43 @@
+/**
+ * @file	buddy_allocator.h
+ * @brief	buddy allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_BUDDY_ALLOCATOR_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_BUDDY_ALLOCATOR_H_INCLUDED_
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void BuddyAllocator_initialize(void);
+void BuddyAllocator_terminate(void);
+
+unsigned long BuddyAllocator_totalAllocationRequests(void);
+unsigned long BuddyAllocator_totalDeallocationRequests(void);
+
+size_t BuddyAllocator_totalAllocatedSize(void);
+size_t BuddyAllocator_allocatableSizeMax(void);
+
+size_t BuddyAllocator_minOrder(void);
+size_t BuddyAllocator_maxOrder(void);
+size_t BuddyAllocator_freeBlockNum(size_t order);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDPSES_KERNEL_MEMORY_BUDDY_ALLOCATOR_H_INCLUDED_ */
@@ -0,0 +1,13 @@
+/**
+ * @file	buddy_allocator_cfg.h
+ * @brief	buddy allocator configuration
+ */
+
+/*! @note The base must be aligned to the largest block (2^kBUDDY_ALLOCATOR_MAX_ORDER). */
+//#define BUDDY_ALLOCATOR_MEMORY_POOL_BASE 0x00000000UL
+
+enum { kBUDDY_ALLOCATOR_MIN_ORDER = 6 };	/*!< smallest block: 2^6 = 64 bytes */
+enum { kBUDDY_ALLOCATOR_MAX_ORDER = 14 };	/*!< largest block: 2^14 = 16 KiB */
+
+/*! @note A multiple of the largest block. */
+enum { kBUDDY_ALLOCATOR_SIZE_MAX = (1024 * 64) };
@@ -0,0 +1,285 @@
+/**
+ * @file	object_cache.c
+ * @brief	object cache (slab of fixed-size objects)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "allocator_private.h"
+#include "object_cache.h"
+#include "lib_assert.h"
+#include "lib_debug.h"
+
+/**
+ * @struct	FreeObject
+ * @brief	Link stored in a free object
+ */
+struct FreeObject {
+	struct FreeObject* next;
+};
+
+/**
+ * @struct	ObjectCache
+ * @brief	ObjectCache struct
+ * @extends	Allocator
+ * @note	The control and the slab are one block of the heap:
+ *			[ObjectCache][object 0][object 1]...
+ */
+struct ObjectCache {
+	struct Allocator allocator; /*!< must be the first member for mutual conversion of pointers */
+
+	struct Allocator* heap;	/*!< heap of the block (NULL: the default heap) */
+	size_t objectSize;		/*!< stride: the size rounded up to the alignment */
+	size_t alignment;		/*!< of every object */
+	size_t objectNum;
+	size_t availableObjects;
+	uint8_t* begin;
+	uint8_t* end;
+	struct FreeObject* free;
+};
+
+enum { kDEFAULT_ALIGNMENT = 8 };	/*!< power-of-two */
+
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
+
+static inline size_t round_up(const size_t size, const size_t alignment) {
+	return ((size + (alignment - 1)) & ~(alignment - 1));
+}
+
+/**
+ * @brief	Get the size of ObjectCache
+ * @return	the size of ObjectCache (without the slab)
+ */
+size_t ObjectCache_sizeOf(void)
+{
+	return sizeof(struct ObjectCache);
+}
+
+/**
+ * @brief	Create
+ * @param	size			object size in bytes
+ * @param	alignment		object alignment (power of two, 0: the default alignment)
+ * @param	count			the number of objects
+ * @return	instance
+ */
+ObjectCache* ObjectCache_create(const size_t size, const size_t alignment, const size_t count)
+{
+	return ObjectCache_createFrom(NULL, size, alignment, count);
+}
+
+/**
+ * @brief	Create on a heap
+ * @param	heap			heap of the control and the slab (NULL: the default heap)
+ * @param	size			object size in bytes
+ * @param	alignment		object alignment (power of two, 0: the default alignment)
+ * @param	count			the number of objects
+ * @return	instance
+ *
+ * @note One allocation from the heap for all the objects: they are allocated
+ *       and released in O(1) without touching the heap again.
+ */
+ObjectCache* ObjectCache_createFrom(Allocator* const heap, const size_t size, const size_t alignment, const size_t count)
+{
+	ASSERT_((alignment & (alignment - 1)) == 0);
+	ASSERT_((size > 0) && (count > 0));
+
+	const size_t objectAlignment = (alignment > kDEFAULT_ALIGNMENT) ? alignment : kDEFAULT_ALIGNMENT;
+	const size_t slabOffset = round_up(sizeof(struct ObjectCache), objectAlignment);
+	const size_t stride = round_up((size > sizeof(struct FreeObject)) ? size : sizeof(struct FreeObject), objectAlignment);
+
+	uint8_t* const block = Allocator_allocateAlignedFrom(heap, slabOffset + (stride * count), objectAlignment);
+	if (!block) {
+		FATAL_("Cannot allocate memory\r\n");
+		return NULL;
+	}
+
+	struct ObjectCache* const instance = (struct ObjectCache*)block;
+	instance->allocator.allocate = allocate;
+	instance->allocator.allocateAligned = allocate_aligned;
+	instance->allocator.deallocate = deallocate;
+	instance->allocator.blockSize = allocated_size;
+	Allocator_initializeHeap(&instance->allocator, "object_cache");
+
+	instance->heap = heap;
+	instance->objectSize = stride;
+	instance->alignment = objectAlignment;
+	instance->objectNum = count;
+	instance->availableObjects = count;
+	instance->begin = block + slabOffset;
+	instance->end = instance->begin + (stride * count);
+	instance->free = NULL;
+	for (size_t n = count; n > 0; n--) {
+		struct FreeObject* const object = (struct FreeObject*)(instance->begin + (stride * (n - 1)));
+		object->next = instance->free;
+		instance->free = object;
+	}
+
+	return instance;
+}
+
+/**
+ * @brief	Destroy
+ * @param	self			ObjectCache*
+ * @return	ObjectCache*
+ *
+ * @attention All the objects must have been released.
+ */
+ObjectCache* ObjectCache_destroy(ObjectCache* const self)
+{
+	if (!self) { return NULL; }
+
+	ASSERT_(self->availableObjects == self->objectNum);
+
+	Allocator_deallocateFrom(self->heap, self);
+
+	return NULL;
+}
+
+/**
+ * @brief	Allocate an object
+ * @param	self			ObjectCache*
+ * @retval	!=NULL			success (a pointer to the object)
+ * @retval	NULL			failure (no free objects)
+ */
+void* ObjectCache_allocate(ObjectCache* const self)
+{
+	return Allocator_allocateFrom(&self->allocator, self->objectSize);
+}
+
+/**
+ * @brief	Release an object
+ * @param	self			ObjectCache*
+ * @param	object			pointer to an object of the cache
+ * @return	none
+ */
+void ObjectCache_deallocate(ObjectCache* const self, void* const object)
+{
+	Allocator_deallocateFrom(&self->allocator, object);
+}
+
+/**
+ * @brief	Get the cache as a heap
+ * @param	self			ObjectCache*
+ * @return	the heap (e.g. for FixedQueue8_createFrom() or MbUart_createFrom())
+ *
+ * @note Requests up to the object size get an object; larger ones fail.
+ */
+Allocator* ObjectCache_heap(ObjectCache* const self)
+{
+	return &self->allocator;
+}
+
+/**
+ * @brief	Get the object size
+ * @param	self			ObjectCache*
+ * @return	the object size (the stride, >= the requested size)
+ */
+size_t ObjectCache_objectSize(const ObjectCache* const self)
+{
+	return self->objectSize;
+}
+
+/**
+ * @brief	Get the number of objects
+ * @param	self			ObjectCache*
+ * @return	the number of objects
+ */
+size_t ObjectCache_objectNum(const ObjectCache* const self)
+{
+	return self->objectNum;
+}
+
+/**
+ * @brief	Get the number of free objects
+ * @param	self			ObjectCache*
+ * @return	the number of free objects
+ */
+size_t ObjectCache_availableObjects(const ObjectCache* const self)
+{
+	return self->availableObjects;
+}
+
+/**
+ * @brief	Allocate memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ */
+static void* allocate(struct Allocator* const self, const size_t size)
+{
+	struct ObjectCache* const cache = (struct ObjectCache*)self;
+
+	if ((size > cache->objectSize) || !cache->free) { return NULL; }
+
+	struct FreeObject* const object = cache->free;
+	cache->free = object->next;
+	cache->availableObjects--;
+
+	return object;
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure (e.g. beyond the object alignment)
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	if (alignment > ((const struct ObjectCache*)self)->alignment) { return NULL; }
+
+	return allocate(self, size);
+}
+
+/**
+ * @brief	Deallocate memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	none
+ */
+static void deallocate(struct Allocator* const self, void* const ptr)
+{
+	struct ObjectCache* const cache = (struct ObjectCache*)self;
+
+	if (!ptr) { return; }
+
+	/*! @attention The pointer must be an object of this cache. */
+	ASSERT_(((uint8_t*)ptr >= cache->begin) && ((uint8_t*)ptr < cache->end));
+	ASSERT_((((uint8_t*)ptr - cache->begin) % cache->objectSize) == 0);
+
+	struct FreeObject* const object = ptr;
+	object->next = cache->free;
+	cache->free = object;
+	cache->availableObjects++;
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	the object size
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)ptr;
+
+	return ((const struct ObjectCache*)self)->objectSize;
+}
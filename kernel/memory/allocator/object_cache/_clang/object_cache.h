@@ -0,0 +1,58 @@
+/**
+ * @file	object_cache.h
+ * @brief	object cache (slab of fixed-size objects)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+/**
+	@code sample
+	// a cache of UART instances, each with its queues in the same block
+	const MbUartParams params = { 256, 256 };
+	ObjectCache* const cache = ObjectCache_create(MbUart_blockSize(&params), 0, 2);
+
+	struct MbUart* const uart0 = MbUart_createFrom(ObjectCache_heap(cache), UART0_BASE, INTC_BASE, UART0_IRQ, &params);
+	@endcode
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_OBJECT_CACHE_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_OBJECT_CACHE_H_INCLUDED_
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ObjectCache;
+typedef struct ObjectCache ObjectCache;
+
+size_t ObjectCache_sizeOf(void);
+
+ObjectCache* ObjectCache_create(size_t size, size_t alignment, size_t count);
+ObjectCache* ObjectCache_createFrom(Allocator* heap, size_t size, size_t alignment, size_t count);
+ObjectCache* ObjectCache_destroy(ObjectCache* self);
+
+void* ObjectCache_allocate(ObjectCache* self);
+void ObjectCache_deallocate(ObjectCache* self, void* object);
+
+Allocator* ObjectCache_heap(ObjectCache* self);
+
+size_t ObjectCache_objectSize(const ObjectCache* self);
+size_t ObjectCache_objectNum(const ObjectCache* self);
+size_t ObjectCache_availableObjects(const ObjectCache* self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDPSES_KERNEL_MEMORY_OBJECT_CACHE_H_INCLUDED_ */
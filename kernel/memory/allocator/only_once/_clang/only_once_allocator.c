@@ -18,9 +18,16 @@
 #include <stddef.h>
 
 #include "allocator_private.h"
+#include "allocator_budget.h"
 #include "only_once_allocator.h"
 #include "only_once_allocator_cfg.h"
 #include "lib_assert.h"
+#include "lib_critical_section.h"
+
+#if defined(ONLY_ONCE_ALLOCATOR_BUDGETS)
+/*! @note The pool start may lose up to an alignment unit. */
+ALLOCATOR_BUDGET_CHECK_(ONLY_ONCE_ALLOCATOR_BUDGETS, kONLY_ONCE_ALLOCATOR_SIZE_MAX - (ALLOCATOR_BUDGET_ALIGNMENT - 1));
+#endif
 
 static struct Allocator allocator_;
 
@@ -35,8 +42,9 @@ static uint8_t* end_ = 0;
 
 static size_t totalAllocatedSize_ = 0;
 
-static void* allocate(size_t size);
-static void deallocate(void* ptr);
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
 
 static inline uintptr_t next_aligned_address(const uintptr_t addr) {
 	return ((addr + (kALIGNMENT_UNIT - 1)) & ~(uintptr_t)(kALIGNMENT_UNIT - 1));
@@ -49,7 +57,10 @@ static inline uintptr_t next_aligned_address(const uintptr_t addr) {
 void OnlyOnceAllocator_initialize(void)
 {
 	allocator_.allocate = allocate;
+	allocator_.allocateAligned = allocate_aligned;
 	allocator_.deallocate = deallocate;
+	allocator_.blockSize = NULL;
+	Allocator_initializeHeap(&allocator_, "only_once");
 	Allocator_initialize(&allocator_);
 
 	next_ = (uint8_t*)next_aligned_address((uintptr_t)&memoryPool_[0]);
@@ -103,14 +114,77 @@ size_t OnlyOnceAllocator_allocatableSizeMax(void)
 	return (kONLY_ONCE_ALLOCATOR_SIZE_MAX & ~(uintptr_t)(kALIGNMENT_UNIT - 1));
 }
 
+/**
+ * @brief	Get the total of the memory budget
+ * @return	total of ONLY_ONCE_ALLOCATOR_BUDGETS (0: not declared)
+ *
+ * @note For a report against OnlyOnceAllocator_totalAllocatedSize() and
+ *       OnlyOnceAllocator_allocatableSizeMax() (e.g. at the end of the startup).
+ */
+size_t OnlyOnceAllocator_budgetSize(void)
+{
+#if defined(ONLY_ONCE_ALLOCATOR_BUDGETS)
+	return ALLOCATOR_BUDGET_TOTAL_(ONLY_ONCE_ALLOCATOR_BUDGETS);
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief	Take a mark
+ * @return	the current position
+ *
+ * @note Marks nest: take a mark, allocate freely (e.g. per frame), then
+ *       release back to it. Releasing an outer mark also releases the inner ones.
+ */
+OnlyOnceAllocatorMark OnlyOnceAllocator_mark(void)
+{
+	const lib_critical_section_t context = (allocator_.isrSafe) ? lib_critical_section_enter() : 0;
+
+	OnlyOnceAllocatorMark mark;
+	mark.next = next_;
+	mark.totalAllocatedSize = totalAllocatedSize_;
+	mark.liveBytes = allocator_.stats.liveBytes;
+	mark.liveBlocks = allocator_.stats.liveBlocks;
+
+	if (allocator_.isrSafe) { lib_critical_section_exit(context); }
+
+	return mark;
+}
+
+/**
+ * @brief	Release all memory blocks allocated after a mark
+ * @param	mark			mark taken by OnlyOnceAllocator_mark()
+ * @return	none
+ *
+ * @note O(1): rolls the bump pointer back. No destructor is called.
+ * @pre the mark is not behind an already released mark
+ */
+void OnlyOnceAllocator_release(const OnlyOnceAllocatorMark mark)
+{
+	const lib_critical_section_t context = (allocator_.isrSafe) ? lib_critical_section_enter() : 0;
+
+	ASSERT_(((uint8_t*)mark.next >= &memoryPool_[0]) && ((uint8_t*)mark.next <= next_));
+
+	next_ = mark.next;
+	totalAllocatedSize_ = mark.totalAllocatedSize;
+	allocator_.stats.liveBytes = mark.liveBytes;
+	allocator_.stats.liveBlocks = mark.liveBlocks;
+
+	if (allocator_.isrSafe) { lib_critical_section_exit(context); }
+}
+
 /**
  * @brief	Allocate memory block
+ * @param	self			Allocator*
  * @param	size			size in bytes
  * @retval	!=NULL			success (a pointer to the memory block)
  * @retval	NULL			failure
  */
-static void* allocate(const size_t size)
+static void* allocate(struct Allocator* const self, const size_t size)
 {
+	(void)self;
+
 	ASSERT_(((uintptr_t)next_ + size) <= (uintptr_t)end_);
 
 	void* const ptr = next_;
@@ -120,14 +194,41 @@ static void* allocate(const size_t size)
 	return ptr;
 }
 
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note The padding in front of the block is counted as allocated.
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	(void)self;
+
+	uint8_t* const ptr = (uint8_t*)(((uintptr_t)next_ + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+	ASSERT_(((uintptr_t)ptr + size) <= (uintptr_t)end_);
+
+	uint8_t* const prev = next_;
+	next_ = (uint8_t*)next_aligned_address((uintptr_t)ptr + size);
+	totalAllocatedSize_ += (next_ - prev);
+
+	return ptr;
+}
+
 /**
  * @brief	Deallocate memory block
+ * @param	self			Allocator*
  * @param	ptr				pointer to the memory block
  * @return	none
  */
-static void deallocate(void* const ptr)
+static void deallocate(struct Allocator* const self, void* const ptr)
 {
-	/*! @attention This memory allocator does not support release of memory. */
+	(void)self;
+
+	/*! @attention This memory allocator does not support release of each block (see OnlyOnceAllocator_release()). */
 	ASSERT_(kASSERT_FAILURE);
 
 	(void)ptr;
@@ -23,6 +23,18 @@
 extern "C" {
 #endif
 
+/**
+ * @struct	OnlyOnceAllocatorMark
+ * @brief	Position to roll back to by OnlyOnceAllocator_release()
+ * @note	Treat as opaque.
+ */
+typedef struct {
+	void* next;
+	size_t totalAllocatedSize;
+	size_t liveBytes;
+	size_t liveBlocks;
+} OnlyOnceAllocatorMark;
+
 void OnlyOnceAllocator_initialize(void);
 void OnlyOnceAllocator_terminate(void);
 
@@ -31,6 +43,10 @@ unsigned long OnlyOnceAllocator_totalDeallocationRequests(void);
 
 size_t OnlyOnceAllocator_totalAllocatedSize(void);
 size_t OnlyOnceAllocator_allocatableSizeMax(void);
+size_t OnlyOnceAllocator_budgetSize(void);
+
+OnlyOnceAllocatorMark OnlyOnceAllocator_mark(void);
+void OnlyOnceAllocator_release(OnlyOnceAllocatorMark mark);
 
 #ifdef __cplusplus
 }
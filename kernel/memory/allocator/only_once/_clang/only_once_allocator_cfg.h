@@ -7,4 +7,11 @@
 
 enum { kONLY_ONCE_ALLOCATOR_SIZE_MAX = (1024 * 16) };
 
+/*!
+ * @brief	Worst-case allocations of the product: BUDGET(name, bytes)
+ * @note	Checked against kONLY_ONCE_ALLOCATOR_SIZE_MAX at build time (see allocator_budget.h).
+ *			Include the headers declaring the budget macros here.
+ */
+//#define ONLY_ONCE_ALLOCATOR_BUDGETS(BUDGET) BUDGET(uart0, MB_UART_BUDGET_(256, 256)) BUDGET(log, FIXED_QUEUE8_BUDGET_(1024))
+
 static const uintptr_t kALIGNMENT_UNIT = (1UL << 3); /*!< power-of-two */
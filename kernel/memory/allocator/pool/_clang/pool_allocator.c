@@ -0,0 +1,342 @@
+/**
+ * @file	pool_allocator.c
+ * @brief	pool allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "allocator_private.h"
+#include "pool_allocator.h"
+#include "pool_allocator_cfg.h"
+#include "lib_assert.h"
+
+/**
+ * @struct	FreeBlock
+ * @brief	Link stored in a free block
+ */
+struct FreeBlock {
+	struct FreeBlock* next;
+};
+
+/**
+ * @struct	SizeClass
+ * @brief	Blocks of one size, kept in a contiguous range of the pool
+ */
+struct SizeClass {
+	size_t blockSize;
+	size_t blockNum;
+	size_t availableBlocks;
+	uint8_t* begin;
+	uint8_t* end;
+	struct FreeBlock* free;
+};
+
+#define POOL_ALLOCATOR_CLASS_SIZE_(block_size, block_num)		+ ((block_size) * (block_num))
+#define POOL_ALLOCATOR_CLASS_NUM_(block_size, block_num)		+ 1
+#define POOL_ALLOCATOR_CLASS_MAX_(block_size, block_num)		uint8_t block##block_size[block_size];
+#define POOL_ALLOCATOR_CLASS_INIT_(block_size, block_num)		{ (block_size), (block_num), 0, 0, 0, 0 },
+
+enum {
+	kPOOL_ALLOCATOR_SIZE_MAX = (0 POOL_ALLOCATOR_CLASSES(POOL_ALLOCATOR_CLASS_SIZE_)),
+	kCLASS_NUM = (0 POOL_ALLOCATOR_CLASSES(POOL_ALLOCATOR_CLASS_NUM_)),
+	kBLOCK_SIZE_MAX = sizeof(union { POOL_ALLOCATOR_CLASSES(POOL_ALLOCATOR_CLASS_MAX_) }),
+	kCLASS_ALIGNMENT_MAX = 64,	/*!< blocks of a class are aligned to their block size, up to this */
+	kGRANULE_SHIFT = 6,
+	kGRANULE_SIZE = (1 << kGRANULE_SHIFT),	/*!< every class starts at a granule (>= kCLASS_ALIGNMENT_MAX) */
+	kPOOL_MARGIN = (kGRANULE_SIZE * kCLASS_NUM),	/*!< for aligning the class starts */
+	kPOOL_REGION_SIZE = (kPOOL_ALLOCATOR_SIZE_MAX + kPOOL_MARGIN),
+	kGRANULE_NUM = ((kPOOL_REGION_SIZE + (kGRANULE_SIZE - 1)) / kGRANULE_SIZE)
+};
+
+static struct Allocator allocator_;
+
+#if defined(POOL_ALLOCATOR_MEMORY_POOL_BASE)
+static uint8_t* const memoryPool_ = (uint8_t*)POOL_ALLOCATOR_MEMORY_POOL_BASE;
+#else
+static uint8_t memoryPool_[kPOOL_REGION_SIZE];
+#endif
+
+static struct SizeClass classes_[kCLASS_NUM] = { POOL_ALLOCATOR_CLASSES(POOL_ALLOCATOR_CLASS_INIT_) };
+
+/*! smallest class index for each size in kALIGNMENT_UNIT steps */
+static uint8_t classOfSize_[(kBLOCK_SIZE_MAX / kALIGNMENT_UNIT) + 1];
+
+/*! class index of each granule from the start of the first class */
+static uint8_t classOfGranule_[kGRANULE_NUM];
+static uint8_t* poolBegin_;
+static uint8_t* poolEnd_;
+
+static size_t totalAllocatedSize_ = 0;
+
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
+
+static inline size_t size_step(const size_t size) {
+	return ((size + (kALIGNMENT_UNIT - 1)) / kALIGNMENT_UNIT);
+}
+
+/*! @note Every block of a class is aligned to this (the lowest set bit of the block size). */
+static inline size_t class_alignment(const size_t block_size) {
+	const size_t lowest = block_size & (~block_size + 1);
+	return (lowest < kCLASS_ALIGNMENT_MAX) ? lowest : kCLASS_ALIGNMENT_MAX;
+}
+
+static inline void* take_block(struct SizeClass* const size_class) {
+	struct FreeBlock* const block = size_class->free;
+	size_class->free = block->next;
+	size_class->availableBlocks--;
+	totalAllocatedSize_ += size_class->blockSize;
+	return block;
+}
+
+/*! @note O(1): the class is looked up by the granule of the address. */
+static struct SizeClass* class_of_pointer(const void* const ptr)
+{
+	const uint8_t* const p = ptr;
+
+	/*! @attention The pointer must be allocated by this allocator. */
+	ASSERT_((p >= poolBegin_) && (p < poolEnd_));
+
+	struct SizeClass* const sizeClass = &classes_[classOfGranule_[(size_t)(p - poolBegin_) >> kGRANULE_SHIFT]];
+	ASSERT_((p >= sizeClass->begin) && (p < sizeClass->end));
+	ASSERT_(((size_t)(p - sizeClass->begin) % sizeClass->blockSize) == 0);
+
+	return sizeClass;
+}
+
+/**
+ * @brief	Initialize
+ * @return	none
+ */
+void PoolAllocator_initialize(void)
+{
+	allocator_.allocate = allocate;
+	allocator_.allocateAligned = allocate_aligned;
+	allocator_.deallocate = deallocate;
+	allocator_.blockSize = allocated_size;
+	Allocator_initializeHeap(&allocator_, "pool");
+	Allocator_initialize(&allocator_);
+
+	ASSERT_((int)kALIGNMENT_UNIT <= (int)kGRANULE_SIZE);
+	ASSERT_((int)kCLASS_ALIGNMENT_MAX <= (int)kGRANULE_SIZE);
+	ASSERT_(size_step(kBLOCK_SIZE_MAX) < (sizeof(classOfSize_) / sizeof(classOfSize_[0])));
+
+	uint8_t* next = &memoryPool_[0];
+	size_t step = 0;
+	poolBegin_ = NULL;
+
+	for (size_t i = 0; i < kCLASS_NUM; i++) {
+		struct SizeClass* const sizeClass = &classes_[i];
+		ASSERT_((sizeClass->blockSize % kALIGNMENT_UNIT) == 0);
+
+		/* a granule belongs to one class only */
+		next = (uint8_t*)(((uintptr_t)next + (kGRANULE_SIZE - 1)) & ~(uintptr_t)(kGRANULE_SIZE - 1));
+		if (!poolBegin_) { poolBegin_ = next; }
+
+		sizeClass->begin = next;
+		sizeClass->end = next + (sizeClass->blockSize * sizeClass->blockNum);
+		/*! @attention An external region must provide the margin (see pool_allocator_cfg.h). */
+		ASSERT_(sizeClass->end <= &memoryPool_[kPOOL_REGION_SIZE]);
+		sizeClass->availableBlocks = sizeClass->blockNum;
+		sizeClass->free = NULL;
+		for (size_t n = sizeClass->blockNum; n > 0; n--) {
+			struct FreeBlock* const block = (struct FreeBlock*)(next + (sizeClass->blockSize * (n - 1)));
+			block->next = sizeClass->free;
+			sizeClass->free = block;
+		}
+		next = sizeClass->end;
+
+		for (size_t g = (size_t)(sizeClass->begin - poolBegin_) >> kGRANULE_SHIFT;
+				g <= ((size_t)(sizeClass->end - 1 - poolBegin_) >> kGRANULE_SHIFT); g++) {
+			classOfGranule_[g] = (uint8_t)i;
+		}
+
+		for (; step <= size_step(sizeClass->blockSize); step++) {
+			classOfSize_[step] = (uint8_t)i;
+		}
+	}
+
+	poolEnd_ = next;
+
+	totalAllocatedSize_ = 0;
+}
+
+/**
+ * @brief	Terminate
+ * @return	none
+ */
+void PoolAllocator_terminate(void)
+{
+	totalAllocatedSize_ = 0;
+	Allocator_terminate();
+}
+
+/**
+ * @brief	Get total number of memory allocation requests
+ * @return	total number of memory allocation requests
+ */
+unsigned long PoolAllocator_totalAllocationRequests(void)
+{
+	return Allocator_totalAllocationRequests();
+}
+
+/**
+ * @brief	Get total number of memory deallocation requests
+ * @return	total number of memory deallocation requests
+ */
+unsigned long PoolAllocator_totalDeallocationRequests(void)
+{
+	return Allocator_totalDeallocationRequests();
+}
+
+/**
+ * @brief	Get total size of allocated memory
+ * @return	total size of allocated memory (in blocks)
+ */
+size_t PoolAllocator_totalAllocatedSize(void)
+{
+	return totalAllocatedSize_;
+}
+
+/**
+ * @brief	Get total capacity of allocatable memory
+ * @return	total capacity of allocatable memory
+ */
+size_t PoolAllocator_allocatableSizeMax(void)
+{
+	return kPOOL_ALLOCATOR_SIZE_MAX;
+}
+
+/**
+ * @brief	Get the number of size classes
+ * @return	the number of size classes
+ */
+size_t PoolAllocator_classNum(void)
+{
+	return kCLASS_NUM;
+}
+
+/**
+ * @brief	Get the block size of the class
+ * @param	class_index		class index [0, PoolAllocator_classNum())
+ * @return	block size [byte]
+ */
+size_t PoolAllocator_classBlockSize(const size_t class_index)
+{
+	ASSERT_(class_index < kCLASS_NUM);
+
+	return classes_[class_index].blockSize;
+}
+
+/**
+ * @brief	Get the number of free blocks of the class
+ * @param	class_index		class index [0, PoolAllocator_classNum())
+ * @return	the number of free blocks
+ */
+size_t PoolAllocator_classAvailableBlocks(const size_t class_index)
+{
+	ASSERT_(class_index < kCLASS_NUM);
+
+	return classes_[class_index].availableBlocks;
+}
+
+/**
+ * @brief	Allocate memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note The smallest fitting class is looked up by table. If it is exhausted,
+ *       the next larger classes are tried (at most the number of classes).
+ */
+static void* allocate(struct Allocator* const self, const size_t size)
+{
+	(void)self;
+
+	if (size > kBLOCK_SIZE_MAX) { return NULL; }
+
+	for (size_t i = classOfSize_[size_step(size)]; i < kCLASS_NUM; i++) {
+		struct SizeClass* const sizeClass = &classes_[i];
+		if (sizeClass->free) { return take_block(sizeClass); }
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note Like allocate(), but only from classes whose blocks are all aligned
+ *       (e.g. 32 or 64-byte blocks for 32-byte cache lines).
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	(void)self;
+
+	if ((size > kBLOCK_SIZE_MAX) || (alignment > kCLASS_ALIGNMENT_MAX)) { return NULL; }
+
+	for (size_t i = classOfSize_[size_step(size)]; i < kCLASS_NUM; i++) {
+		struct SizeClass* const sizeClass = &classes_[i];
+		if ((class_alignment(sizeClass->blockSize) >= alignment) && sizeClass->free) {
+			return take_block(sizeClass);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief	Deallocate memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	none
+ *
+ * @note O(1): see class_of_pointer().
+ */
+static void deallocate(struct Allocator* const self, void* const ptr)
+{
+	(void)self;
+
+	if (!ptr) { return; }
+
+	struct SizeClass* const sizeClass = class_of_pointer(ptr);
+
+	struct FreeBlock* const block = ptr;
+	block->next = sizeClass->free;
+	sizeClass->free = block;
+	sizeClass->availableBlocks++;
+	totalAllocatedSize_ -= sizeClass->blockSize;
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	the block size of the class
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)self;
+
+	return class_of_pointer(ptr)->blockSize;
+}
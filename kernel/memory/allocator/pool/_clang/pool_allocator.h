@@ -0,0 +1,43 @@
+/**
+ * @file	pool_allocator.h
+ * @brief	pool allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_POOL_ALLOCATOR_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_POOL_ALLOCATOR_H_INCLUDED_
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void PoolAllocator_initialize(void);
+void PoolAllocator_terminate(void);
+
+unsigned long PoolAllocator_totalAllocationRequests(void);
+unsigned long PoolAllocator_totalDeallocationRequests(void);
+
+size_t PoolAllocator_totalAllocatedSize(void);
+size_t PoolAllocator_allocatableSizeMax(void);
+
+size_t PoolAllocator_classNum(void);
+size_t PoolAllocator_classBlockSize(size_t class_index);
+size_t PoolAllocator_classAvailableBlocks(size_t class_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDPSES_KERNEL_MEMORY_POOL_ALLOCATOR_H_INCLUDED_ */
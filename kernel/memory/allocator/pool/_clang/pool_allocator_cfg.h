@@ -0,0 +1,25 @@
+/**
+ * @file	pool_allocator_cfg.h
+ * @brief	pool allocator configuration
+ */
+
+/*!
+ * @note	An external region must hold the classes plus 64 bytes per class for
+ *			aligning the class starts (the same size as the internal pool).
+ */
+//#define POOL_ALLOCATOR_MEMORY_POOL_BASE 0x00000000UL
+
+/*!
+ * @brief	Size classes: CLASS(block size [byte], number of blocks)
+ * @note	List them in ascending order of block size.
+ *			Block sizes must be multiples of kALIGNMENT_UNIT.
+ */
+#define POOL_ALLOCATOR_CLASSES(CLASS) \
+	CLASS(16, 32) \
+	CLASS(32, 32) \
+	CLASS(64, 16) \
+	CLASS(128, 8) \
+	CLASS(256, 8) \
+	CLASS(1024, 4)
+
+enum { kALIGNMENT_UNIT = (1 << 3) }; /*!< power-of-two */
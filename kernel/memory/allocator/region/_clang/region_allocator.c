@@ -0,0 +1,294 @@
+/**
+ * @file	region_allocator.c
+ * @brief	region allocator (several memory regions of different speed tiers)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "allocator_private.h"
+#include "region_allocator.h"
+#include "region_allocator_cfg.h"
+#include "tlsf_allocator.h"
+#include "lib_assert.h"
+
+/**
+ * @struct	Region
+ * @brief	Memory region (a TLSF heap on the region)
+ */
+struct Region {
+	struct Allocator* heap;
+	const uint8_t* begin;
+	const uint8_t* end;
+	size_t size;
+	enum AllocatorPlacement tier;
+};
+
+enum { kPASS_NUM = 2 };	/*!< the requested tier, then the fallback tier */
+
+/*! @note One view per placement: each searches the regions in its own order. */
+static struct Allocator views_[kALLOCATOR_PLACEMENT_NUM];
+
+static struct Region regions_[kREGION_ALLOCATOR_REGION_NUM_MAX];
+static size_t regionNum_ = 0;
+
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
+
+static inline enum AllocatorPlacement placement_of_view(const struct Allocator* const view) {
+	return (enum AllocatorPlacement)(view - &views_[0]);
+}
+
+/*! @note kALLOCATOR_PLACEMENT_NUM: no region is searched in the pass. */
+static inline enum AllocatorPlacement tier_of_pass(const enum AllocatorPlacement placement, const int pass) {
+	if (placement == kALLOCATOR_PLACEMENT_FAST) {
+		return (pass == 0) ? kALLOCATOR_PLACEMENT_FAST : kALLOCATOR_PLACEMENT_BULK;
+	}
+	if (pass == 0) { return kALLOCATOR_PLACEMENT_BULK; }
+	return (kREGION_ALLOCATOR_FALLBACK_TO_FAST) ? kALLOCATOR_PLACEMENT_FAST : kALLOCATOR_PLACEMENT_NUM;
+}
+
+/*! @note The region is found from the address range (at most the number of regions). */
+static const struct Region* region_of_pointer(const void* const ptr)
+{
+	const uint8_t* const p = ptr;
+	for (size_t i = 0; i < regionNum_; i++) {
+		const struct Region* const region = &regions_[i];
+		if ((p >= region->begin) && (p < region->end)) { return region; }
+	}
+
+	/*! @attention The pointer was not allocated by this allocator. */
+	ASSERT_(kASSERT_FAILURE);
+	return NULL;
+}
+
+/**
+ * @brief	Initialize
+ * @return	none
+ *
+ * @note The any view becomes the default heap, and the fast and bulk views
+ *       the heaps of Allocator_placementHeap(). Add the regions next.
+ */
+void RegionAllocator_initialize(void)
+{
+	static const char* const kVIEW_NAMES[kALLOCATOR_PLACEMENT_NUM] = { "any", "fast", "bulk" };
+
+	for (size_t i = 0; i < kALLOCATOR_PLACEMENT_NUM; i++) {
+		struct Allocator* const view = &views_[i];
+		view->allocate = allocate;
+		view->allocateAligned = allocate_aligned;
+		view->deallocate = deallocate;
+		view->blockSize = allocated_size;
+		Allocator_initializeHeap(view, kVIEW_NAMES[i]);
+	}
+
+	regionNum_ = 0;
+
+	Allocator_initialize(&views_[kALLOCATOR_PLACEMENT_ANY]);
+	Allocator_setPlacementHeap(kALLOCATOR_PLACEMENT_FAST, &views_[kALLOCATOR_PLACEMENT_FAST]);
+	Allocator_setPlacementHeap(kALLOCATOR_PLACEMENT_BULK, &views_[kALLOCATOR_PLACEMENT_BULK]);
+}
+
+/**
+ * @brief	Terminate
+ * @return	none
+ */
+void RegionAllocator_terminate(void)
+{
+	regionNum_ = 0;
+	Allocator_terminate();
+}
+
+/**
+ * @brief	Add a memory region
+ * @param	memory			base address of the region
+ * @param	size			size of the region in bytes
+ * @param	tier			kALLOCATOR_PLACEMENT_FAST or kALLOCATOR_PLACEMENT_BULK
+ * @param	name			name of the region heap
+ * @retval	!=NULL			success (the region heap)
+ * @retval	NULL			failure (too many regions or the region is too small)
+ *
+ * @note Regions of a tier are searched in the order they are added.
+ *       A fast request falls back to the bulk regions; bulk and any requests
+ *       fall back to the fast regions if kREGION_ALLOCATOR_FALLBACK_TO_FAST.
+ * @note The heap control is placed at the beginning of the region (see TlsfAllocator_createHeap()).
+ * @attention Select the ISR-safe mode on the region heap: it is shared by every placement.
+ */
+Allocator* RegionAllocator_addRegion(void* const memory, const size_t size,
+		const enum AllocatorPlacement tier, const char* const name)
+{
+	ASSERT_((tier == kALLOCATOR_PLACEMENT_FAST) || (tier == kALLOCATOR_PLACEMENT_BULK));
+
+	if (regionNum_ >= kREGION_ALLOCATOR_REGION_NUM_MAX) { return NULL; }
+
+	struct Allocator* const heap = TlsfAllocator_createHeap(memory, size, name);
+	if (!heap) { return NULL; }
+
+	struct Region* const region = &regions_[regionNum_];
+	region->heap = heap;
+	region->begin = memory;
+	region->end = (const uint8_t*)memory + size;
+	region->size = size;
+	region->tier = tier;
+	regionNum_++;
+
+	return heap;
+}
+
+/**
+ * @brief	Get total number of memory allocation requests
+ * @return	total number of memory allocation requests (the any view)
+ */
+unsigned long RegionAllocator_totalAllocationRequests(void)
+{
+	return Allocator_totalAllocationRequests();
+}
+
+/**
+ * @brief	Get total number of memory deallocation requests
+ * @return	total number of memory deallocation requests (the any view)
+ */
+unsigned long RegionAllocator_totalDeallocationRequests(void)
+{
+	return Allocator_totalDeallocationRequests();
+}
+
+/**
+ * @brief	Get total size of allocated memory
+ * @return	total size of allocated memory (all regions, all placements)
+ */
+size_t RegionAllocator_totalAllocatedSize(void)
+{
+	size_t total = 0;
+	for (size_t i = 0; i < regionNum_; i++) {
+		struct AllocatorStatistics stats;
+		Allocator_heapStatistics(regions_[i].heap, &stats);
+		total += stats.liveBytes;
+	}
+
+	return total;
+}
+
+/**
+ * @brief	Get total capacity of allocatable memory
+ * @return	total capacity of allocatable memory (the sum of the region sizes)
+ */
+size_t RegionAllocator_allocatableSizeMax(void)
+{
+	size_t total = 0;
+	for (size_t i = 0; i < regionNum_; i++) {
+		total += regions_[i].size;
+	}
+
+	return total;
+}
+
+/**
+ * @brief	Get the number of regions
+ * @return	the number of regions
+ */
+size_t RegionAllocator_regionNum(void)
+{
+	return regionNum_;
+}
+
+/**
+ * @brief	Get the heap of the region
+ * @param	region_index	region index [0, RegionAllocator_regionNum())
+ * @return	the region heap (e.g. for Allocator_heapStatistics())
+ */
+Allocator* RegionAllocator_regionHeap(const size_t region_index)
+{
+	ASSERT_(region_index < regionNum_);
+
+	return regions_[region_index].heap;
+}
+
+/**
+ * @brief	Allocate memory block
+ * @param	self			Allocator* (a view)
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ */
+static void* allocate(struct Allocator* const self, const size_t size)
+{
+	return allocate_aligned(self, size, 0);
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator* (a view)
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two, 0: the default alignment)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note The regions of the placement's tier are tried first, then those of
+ *       the fallback tier. Each region heap keeps its own statistics
+ *       (a failure there means the region was exhausted).
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	const enum AllocatorPlacement placement = placement_of_view(self);
+
+	for (int pass = 0; pass < kPASS_NUM; pass++) {
+		const enum AllocatorPlacement tier = tier_of_pass(placement, pass);
+		for (size_t i = 0; i < regionNum_; i++) {
+			if (regions_[i].tier != tier) { continue; }
+
+			void* const ptr = Allocator_allocateAlignedFrom(regions_[i].heap, size, alignment);
+			if (ptr) { return ptr; }
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief	Deallocate memory block
+ * @param	self			Allocator* (a view)
+ * @param	ptr				pointer to the memory block
+ * @return	none
+ *
+ * @note Release a block to the view it was allocated from (for the view
+ *       statistics). The region is found from the address: see region_of_pointer().
+ */
+static void deallocate(struct Allocator* const self, void* const ptr)
+{
+	(void)self;
+
+	if (!ptr) { return; }
+
+	const struct Region* const region = region_of_pointer(ptr);
+	if (!region) { return; }
+
+	Allocator_deallocateFrom(region->heap, ptr);
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator* (a view)
+ * @param	ptr				pointer to the memory block
+ * @return	the block size in the region heap
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)self;
+
+	const struct Region* const region = region_of_pointer(ptr);
+	return (region) ? region->heap->blockSize(region->heap, ptr) : 0;
+}
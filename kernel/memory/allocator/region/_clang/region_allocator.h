@@ -0,0 +1,45 @@
+/**
+ * @file	region_allocator.h
+ * @brief	region allocator (several memory regions of different speed tiers)
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_REGION_ALLOCATOR_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_REGION_ALLOCATOR_H_INCLUDED_
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void RegionAllocator_initialize(void);
+void RegionAllocator_terminate(void);
+
+Allocator* RegionAllocator_addRegion(void* memory, size_t size,
+		enum AllocatorPlacement tier, const char* name);
+
+unsigned long RegionAllocator_totalAllocationRequests(void);
+unsigned long RegionAllocator_totalDeallocationRequests(void);
+
+size_t RegionAllocator_totalAllocatedSize(void);
+size_t RegionAllocator_allocatableSizeMax(void);
+
+size_t RegionAllocator_regionNum(void);
+Allocator* RegionAllocator_regionHeap(size_t region_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDPSES_KERNEL_MEMORY_REGION_ALLOCATOR_H_INCLUDED_ */
@@ -0,0 +1,10 @@
+/**
+ * @file	region_allocator_cfg.h
+ * @brief	region allocator configuration
+ */
+
+/*! @note The regions are added by RegionAllocator_addRegion() (e.g. from the base addresses in system.h). */
+enum { kREGION_ALLOCATOR_REGION_NUM_MAX = 4 };
+
+/*! @note 1: bulk (and any) requests take fast regions when the bulk regions are exhausted, 0: fast regions are kept for fast requests */
+enum { kREGION_ALLOCATOR_FALLBACK_TO_FAST = 1 };
@@ -14,17 +14,44 @@
  * http://opensource.org/licenses/mit-license.php
  */
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "allocator_private.h"
 #include "std_allocator.h"
 
+/**
+ * @union	BlockHeader
+ * @brief	Prefix of each block to account the size on deallocation
+ * @note	Padded to the strictest fundamental alignment of malloc().
+ * @note	base is the pointer from malloc() (in front of the header for aligned blocks).
+ */
+union BlockHeader {
+	struct {
+		size_t size;
+		void* base;
+	} info;
+	long double alignLongDouble_;
+	long long alignLongLong_;
+	void* alignPointer_;
+};
+
+/*! @note The block after a header is aligned to this (the alignment of the header, not its size). */
+struct BlockHeaderAlignment {
+	char c;
+	union BlockHeader header;
+};
+enum { kHEADER_ALIGNMENT = offsetof(struct BlockHeaderAlignment, header) };
+
 static struct Allocator allocator_;
 
 static size_t totalAllocatedSize_ = 0;
 
-static void* allocate(size_t size);
-static void deallocate(void* ptr);
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
 
 /**
  * @brief	Initialize
@@ -33,7 +60,10 @@ static void deallocate(void* ptr);
 void StdAllocator_initialize(void)
 {
 	allocator_.allocate = allocate;
+	allocator_.allocateAligned = allocate_aligned;
 	allocator_.deallocate = deallocate;
+	allocator_.blockSize = allocated_size;
+	Allocator_initializeHeap(&allocator_, "std");
 	Allocator_initialize(&allocator_);
 
 	totalAllocatedSize_ = 0;
@@ -77,23 +107,75 @@ size_t StdAllocator_totalAllocatedSize(void)
 
 /**
  * @brief	Allocate memory block
+ * @param	self			Allocator*
  * @param	size			size in bytes
  * @retval	!=NULL			success (a pointer to the memory block)
  * @retval	NULL			failure
  */
-static void* allocate(const size_t size)
+static void* allocate(struct Allocator* const self, const size_t size)
 {
-	void* const rc = malloc(size);
-	if (rc) { totalAllocatedSize_ += size; }
-	return rc;
+	(void)self;
+
+	union BlockHeader* const header = malloc(sizeof(union BlockHeader) + size);
+	if (!header) { return NULL; }
+
+	header->info.size = size;
+	header->info.base = header;
+	totalAllocatedSize_ += size;
+
+	return (header + 1);
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	if (alignment <= kHEADER_ALIGNMENT) { return allocate(self, size); }
+
+	uint8_t* const base = malloc(sizeof(union BlockHeader) + (alignment - 1) + size);
+	if (!base) { return NULL; }
+
+	const uintptr_t first = (uintptr_t)base + sizeof(union BlockHeader);
+	union BlockHeader* const header = (union BlockHeader*)((first + (alignment - 1)) & ~(uintptr_t)(alignment - 1)) - 1;
+	header->info.size = size;
+	header->info.base = base;
+	totalAllocatedSize_ += size;
+
+	return (header + 1);
 }
 
 /**
  * @brief	Deallocate memory block
+ * @param	self			Allocator*
  * @param	ptr				pointer to the memory block
  * @return	none
  */
-static void deallocate(void* const ptr)
+static void deallocate(struct Allocator* const self, void* const ptr)
 {
-	free(ptr);
+	(void)self;
+
+	if (!ptr) { return; }
+
+	union BlockHeader* const header = (union BlockHeader*)ptr - 1;
+	totalAllocatedSize_ -= header->info.size;
+	free(header->info.base);
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	the requested size of the block
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)self;
+
+	return ((const union BlockHeader*)ptr - 1)->info.size;
 }
@@ -0,0 +1,557 @@
+/**
+ * @file	tlsf_allocator.c
+ * @brief	TLSF (Two-Level Segregated Fit) allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "allocator_private.h"
+#include "tlsf_allocator.h"
+#include "tlsf_allocator_cfg.h"
+#include "lib_assert.h"
+#include "lib_critical_section.h"
+
+/**
+ * @struct	Block
+ * @brief	Block header
+ * @note	Used blocks carry only prevPhys and size; the free list links
+ *			overlay the payload of free blocks.
+ */
+struct Block {
+	struct Block* prevPhys;	/*!< previous block in memory (NULL: first) */
+	size_t size;			/*!< payload size | kBLOCK_FREE */
+	struct Block* nextFree;
+	struct Block* prevFree;
+};
+
+enum {
+	kALIGNMENT_UNIT_LOG2 = 3,
+	kALIGNMENT_UNIT = (1 << kALIGNMENT_UNIT_LOG2),
+	kSL_INDEX_COUNT_LOG2 = 4,
+	kSL_INDEX_COUNT = (1 << kSL_INDEX_COUNT_LOG2),
+	kFL_INDEX_SHIFT = (kSL_INDEX_COUNT_LOG2 + kALIGNMENT_UNIT_LOG2),
+	kFL_INDEX_COUNT = (kTLSF_ALLOCATOR_FL_INDEX_MAX - kFL_INDEX_SHIFT + 2),
+	kSMALL_BLOCK_SIZE = (1 << kFL_INDEX_SHIFT),
+	kBLOCK_OVERHEAD = offsetof(struct Block, nextFree),
+	kBLOCK_SIZE_MIN = (sizeof(struct Block) - offsetof(struct Block, nextFree)),
+	kBLOCK_FREE = 1
+};
+
+/**
+ * @struct	TlsfHeap
+ * @brief	TLSF heap control
+ * @extends	Allocator
+ */
+struct TlsfHeap {
+	struct Allocator allocator; /*!< must be the first member for mutual conversion of pointers */
+
+	unsigned int flBitmap;
+	unsigned int slBitmap[kFL_INDEX_COUNT];
+	struct Block* freeLists[kFL_INDEX_COUNT][kSL_INDEX_COUNT];
+
+	size_t allocatableSizeMax;
+	size_t totalAllocatedSize;
+	size_t totalFreeSize;
+	size_t freeBlockNum;
+};
+
+static struct TlsfHeap heap_;
+
+#if defined(TLSF_ALLOCATOR_MEMORY_POOL_BASE)
+static uint8_t* const memoryPool_ = (uint8_t*)TLSF_ALLOCATOR_MEMORY_POOL_BASE;
+#else
+static uint8_t memoryPool_[kTLSF_ALLOCATOR_SIZE_MAX];
+#endif
+
+static void heap_ctor(struct TlsfHeap* heap, uint8_t* memory, size_t size, const char* name);
+static size_t largest_free_block_size(const struct TlsfHeap* heap);
+
+static void* allocate(struct Allocator* self, size_t size);
+static void* allocate_aligned(struct Allocator* self, size_t size, size_t alignment);
+static void deallocate(struct Allocator* self, void* ptr);
+static size_t allocated_size(const struct Allocator* self, const void* ptr);
+
+static inline uintptr_t next_aligned_address(const uintptr_t addr) {
+	return ((addr + (kALIGNMENT_UNIT - 1)) & ~(uintptr_t)(kALIGNMENT_UNIT - 1));
+}
+
+/*! @note index of the most significant bit (x != 0) */
+static inline int fls_size(const size_t x) {
+	return (int)((sizeof(unsigned long) * 8) - 1) - __builtin_clzl((unsigned long)x);
+}
+
+/*! @note index of the least significant bit (x != 0) */
+static inline int ffs_bits(const unsigned int x) {
+	return __builtin_ctz(x);
+}
+
+static inline size_t block_size(const struct Block* const block) {
+	return (block->size & ~(size_t)kBLOCK_FREE);
+}
+
+static inline bool block_is_free(const struct Block* const block) {
+	return (block->size & kBLOCK_FREE) ? true : false;
+}
+
+static inline struct Block* block_next(const struct Block* const block) {
+	return (struct Block*)((uint8_t*)block + kBLOCK_OVERHEAD + block_size(block));
+}
+
+static inline void* block_payload(const struct Block* const block) {
+	return ((uint8_t*)block + kBLOCK_OVERHEAD);
+}
+
+static inline struct Block* block_from_payload(const void* const ptr) {
+	return (struct Block*)((uint8_t*)ptr - kBLOCK_OVERHEAD);
+}
+
+static inline void mapping_insert(const size_t size, int* const fl, int* const sl) {
+	if (size < kSMALL_BLOCK_SIZE) {
+		*fl = 0;
+		*sl = (int)(size / (kSMALL_BLOCK_SIZE / kSL_INDEX_COUNT));
+	} else {
+		const int msb = fls_size(size);
+		*sl = (int)(size >> (msb - kSL_INDEX_COUNT_LOG2)) ^ kSL_INDEX_COUNT;
+		*fl = msb - (kFL_INDEX_SHIFT - 1);
+	}
+}
+
+/*! @note Rounds the size up so that any block of the found list fits. */
+static inline void mapping_search(size_t size, int* const fl, int* const sl) {
+	if (size >= kSMALL_BLOCK_SIZE) {
+		size += ((size_t)1 << (fls_size(size) - kSL_INDEX_COUNT_LOG2)) - 1;
+	}
+	mapping_insert(size, fl, sl);
+}
+
+static void insert_free_block(struct TlsfHeap* const heap, struct Block* const block)
+{
+	int fl, sl;
+	mapping_insert(block_size(block), &fl, &sl);
+
+	struct Block* const head = heap->freeLists[fl][sl];
+	block->nextFree = head;
+	block->prevFree = NULL;
+	if (head) { head->prevFree = block; }
+	heap->freeLists[fl][sl] = block;
+
+	heap->flBitmap |= (1U << fl);
+	heap->slBitmap[fl] |= (1U << sl);
+
+	block->size |= kBLOCK_FREE;
+	heap->totalFreeSize += block_size(block);
+	heap->freeBlockNum++;
+}
+
+static void remove_free_block(struct TlsfHeap* const heap, struct Block* const block)
+{
+	int fl, sl;
+	mapping_insert(block_size(block), &fl, &sl);
+
+	if (block->nextFree) { block->nextFree->prevFree = block->prevFree; }
+	if (block->prevFree) {
+		block->prevFree->nextFree = block->nextFree;
+	} else {
+		heap->freeLists[fl][sl] = block->nextFree;
+		if (!heap->freeLists[fl][sl]) {
+			heap->slBitmap[fl] &= ~(1U << sl);
+			if (!heap->slBitmap[fl]) { heap->flBitmap &= ~(1U << fl); }
+		}
+	}
+
+	block->size &= ~(size_t)kBLOCK_FREE;
+	heap->totalFreeSize -= block_size(block);
+	heap->freeBlockNum--;
+}
+
+/*! @note Splits off the part beyond size as a free block, if it can hold a block. */
+static void trim_block(struct TlsfHeap* const heap, struct Block* const block, const size_t size)
+{
+	if (block_size(block) >= (size + kBLOCK_OVERHEAD + kBLOCK_SIZE_MIN)) {
+		struct Block* const remainder = (struct Block*)((uint8_t*)block_payload(block) + size);
+		remainder->prevPhys = block;
+		remainder->size = block_size(block) - size - kBLOCK_OVERHEAD;
+		block_next(remainder)->prevPhys = remainder;
+		block->size = size;
+		insert_free_block(heap, remainder);
+	}
+}
+
+static inline size_t adjust_size(const size_t size) {
+	return (size < kBLOCK_SIZE_MIN) ? kBLOCK_SIZE_MIN : (size_t)next_aligned_address(size);
+}
+
+/*! @note Good fit in O(1); falls back to the head of the exact list (e.g. one large free block). */
+static struct Block* find_free_block(const struct TlsfHeap* const heap, const size_t size)
+{
+	int fl, sl;
+	mapping_search(size, &fl, &sl);
+
+	if (fl < kFL_INDEX_COUNT) {
+		unsigned int slMap = heap->slBitmap[fl] & (~0U << sl);
+		if (!slMap) {
+			const unsigned int flMap = ((fl + 1) < kFL_INDEX_COUNT) ? (heap->flBitmap & (~0U << (fl + 1))) : 0;
+			if (flMap) {
+				fl = ffs_bits(flMap);
+				slMap = heap->slBitmap[fl];
+			}
+		}
+		if (slMap) { return heap->freeLists[fl][ffs_bits(slMap)]; }
+	}
+
+	mapping_insert(size, &fl, &sl);
+	struct Block* const head = (fl < kFL_INDEX_COUNT) ? heap->freeLists[fl][sl] : NULL;
+
+	return (head && (block_size(head) >= size)) ? head : NULL;
+}
+
+/**
+ * @brief	Initialize
+ * @return	none
+ *
+ * @note The default heap keeps its control in RAM and the whole pool for blocks.
+ */
+void TlsfAllocator_initialize(void)
+{
+	heap_ctor(&heap_, &memoryPool_[0], kTLSF_ALLOCATOR_SIZE_MAX, "tlsf");
+	Allocator_initialize(&heap_.allocator);
+}
+
+/**
+ * @brief	Terminate
+ * @return	none
+ */
+void TlsfAllocator_terminate(void)
+{
+	heap_.totalAllocatedSize = 0;
+	Allocator_terminate();
+}
+
+/**
+ * @brief	Create a heap on a memory region
+ * @param	memory			memory region (e.g. on-chip RAM or external SDRAM)
+ * @param	size			size of the region in bytes
+ * @param	name			name of the heap
+ * @retval	!=NULL			success (the heap for Allocator_allocateFrom())
+ * @retval	NULL			failure (the region is too small)
+ *
+ * @note The heap control is placed at the beginning of the region.
+ *       The part beyond 2^(kTLSF_ALLOCATOR_FL_INDEX_MAX + 1) bytes is not used.
+ */
+Allocator* TlsfAllocator_createHeap(void* const memory, const size_t size, const char* const name)
+{
+	const uintptr_t begin = next_aligned_address((uintptr_t)memory);
+	const uintptr_t end = (uintptr_t)memory + size;
+	const uintptr_t control = next_aligned_address(begin + sizeof(struct TlsfHeap));
+	if ((end < control) || ((end - control) < ((kBLOCK_OVERHEAD * 2) + kBLOCK_SIZE_MIN + kALIGNMENT_UNIT))) { return NULL; }
+
+	struct TlsfHeap* const heap = (struct TlsfHeap*)begin;
+	heap_ctor(heap, (uint8_t*)control, (size_t)(end - control), name);
+
+	return &heap->allocator;
+}
+
+/**
+ * @brief	Get the fragmentation statistics of a heap
+ * @param	heap			Allocator* created by TlsfAllocator_createHeap() (NULL: the default heap)
+ * @param	stats			pointer to the snapshot buffer
+ * @return	none
+ *
+ * @note O(1), so it is short enough for the critical section of an ISR-safe heap.
+ *       The largest free block is approximate (see largest_free_block_size()).
+ */
+void TlsfAllocator_heapStatistics(const Allocator* const heap, struct TlsfAllocatorStatistics* const stats)
+{
+	const struct TlsfHeap* const self = (heap) ? (const struct TlsfHeap*)heap : &heap_;
+
+	const lib_critical_section_t context = (self->allocator.isrSafe) ? lib_critical_section_enter() : 0;
+	stats->totalFreeSize = self->totalFreeSize;
+	stats->freeBlockNum = self->freeBlockNum;
+	stats->largestFreeBlockSize = largest_free_block_size(self);
+	if (self->allocator.isrSafe) { lib_critical_section_exit(context); }
+
+	stats->fragmentation = (stats->totalFreeSize) ?
+			(unsigned int)(100 - ((stats->largestFreeBlockSize * 100) / stats->totalFreeSize)) : 0;
+}
+
+/**
+ * @brief	Get total number of memory allocation requests
+ * @return	total number of memory allocation requests
+ */
+unsigned long TlsfAllocator_totalAllocationRequests(void)
+{
+	return Allocator_totalAllocationRequests();
+}
+
+/**
+ * @brief	Get total number of memory deallocation requests
+ * @return	total number of memory deallocation requests
+ */
+unsigned long TlsfAllocator_totalDeallocationRequests(void)
+{
+	return Allocator_totalDeallocationRequests();
+}
+
+/**
+ * @brief	Get total size of allocated memory
+ * @return	total size of allocated memory (block payloads)
+ */
+size_t TlsfAllocator_totalAllocatedSize(void)
+{
+	return heap_.totalAllocatedSize;
+}
+
+/**
+ * @brief	Get total capacity of allocatable memory
+ * @return	total capacity of allocatable memory (a single block)
+ */
+size_t TlsfAllocator_allocatableSizeMax(void)
+{
+	return heap_.allocatableSizeMax;
+}
+
+/**
+ * @brief	Get total size of free memory
+ * @return	total size of free memory (block payloads)
+ */
+size_t TlsfAllocator_totalFreeSize(void)
+{
+	return heap_.totalFreeSize;
+}
+
+/**
+ * @brief	Get the number of free blocks
+ * @return	the number of free blocks
+ */
+size_t TlsfAllocator_freeBlockNum(void)
+{
+	return heap_.freeBlockNum;
+}
+
+/**
+ * @brief	Get the size of the largest free block
+ * @return	the size of the largest free block (approximate: a lower bound)
+ */
+size_t TlsfAllocator_largestFreeBlockSize(void)
+{
+	struct TlsfAllocatorStatistics stats;
+	TlsfAllocator_heapStatistics(&heap_.allocator, &stats);
+
+	return stats.largestFreeBlockSize;
+}
+
+/**
+ * @brief	Get the fragmentation of free memory
+ * @return	fragmentation [%] (0: all free memory is one block)
+ */
+unsigned int TlsfAllocator_fragmentation(void)
+{
+	struct TlsfAllocatorStatistics stats;
+	TlsfAllocator_heapStatistics(&heap_.allocator, &stats);
+
+	return stats.fragmentation;
+}
+
+/**
+ * @brief	Constructor of a heap
+ * @param	heap			TlsfHeap*
+ * @param	memory			memory region for blocks
+ * @param	size			size of the region in bytes
+ * @param	name			name of the heap
+ * @return	none
+ */
+static void heap_ctor(struct TlsfHeap* const heap, uint8_t* const memory, const size_t size, const char* const name)
+{
+	ASSERT_((sizeof(unsigned int) * 8) >= kFL_INDEX_COUNT);
+
+	heap->allocator.allocate = allocate;
+	heap->allocator.allocateAligned = allocate_aligned;
+	heap->allocator.deallocate = deallocate;
+	heap->allocator.blockSize = allocated_size;
+	Allocator_initializeHeap(&heap->allocator, name);
+
+	heap->flBitmap = 0;
+	for (int fl = 0; fl < kFL_INDEX_COUNT; fl++) {
+		heap->slBitmap[fl] = 0;
+		for (int sl = 0; sl < kSL_INDEX_COUNT; sl++) {
+			heap->freeLists[fl][sl] = NULL;
+		}
+	}
+	heap->totalAllocatedSize = 0;
+	heap->totalFreeSize = 0;
+	heap->freeBlockNum = 0;
+
+	/* one free block covering the region, then a zero-size used sentinel */
+	uint8_t* const begin = (uint8_t*)next_aligned_address((uintptr_t)memory);
+	uint8_t* const end = (uint8_t*)(((uintptr_t)memory + size) & ~(uintptr_t)(kALIGNMENT_UNIT - 1));
+	ASSERT_((size_t)(end - begin) >= ((kBLOCK_OVERHEAD * 2) + kBLOCK_SIZE_MIN));
+
+	const size_t blockSizeMax = (((size_t)1 << (kTLSF_ALLOCATOR_FL_INDEX_MAX + 1)) - 1) & ~(size_t)(kALIGNMENT_UNIT - 1);
+	const size_t firstSize = (size_t)(end - begin) - (kBLOCK_OVERHEAD * 2);
+
+	struct Block* const first = (struct Block*)begin;
+	first->prevPhys = NULL;
+	first->size = (firstSize < blockSizeMax) ? firstSize : blockSizeMax;
+	heap->allocatableSizeMax = first->size;
+
+	struct Block* const sentinel = block_next(first);
+	sentinel->prevPhys = first;
+	sentinel->size = 0;
+
+	insert_free_block(heap, first);
+}
+
+/*!
+ * @note O(1): the head of the highest non-empty list. Only that list can hold
+ *       the largest block, and all its blocks are in one second-level class,
+ *       so the head is a lower bound within one class width of the largest
+ *       (1/kSL_INDEX_COUNT of the first-level size, for diagnostics).
+ */
+static size_t largest_free_block_size(const struct TlsfHeap* const heap)
+{
+	if (!heap->flBitmap) { return 0; }
+
+	const int fl = fls_size(heap->flBitmap);
+	const int sl = fls_size(heap->slBitmap[fl]);
+
+	return block_size(heap->freeLists[fl][sl]);
+}
+
+/**
+ * @brief	Allocate memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note O(1): two bitmap searches, and a split of the found block.
+ */
+static void* allocate(struct Allocator* const self, const size_t size)
+{
+	struct TlsfHeap* const heap = (struct TlsfHeap*)self;
+
+	if (size > heap->allocatableSizeMax) { return NULL; }
+
+	const size_t adjusted = adjust_size(size);
+
+	struct Block* const block = find_free_block(heap, adjusted);
+	if (!block) { return NULL; }
+	remove_free_block(heap, block);
+	trim_block(heap, block, adjusted);
+
+	heap->totalAllocatedSize += block_size(block);
+
+	return block_payload(block);
+}
+
+/**
+ * @brief	Allocate aligned memory block
+ * @param	self			Allocator*
+ * @param	size			size in bytes
+ * @param	alignment		alignment in bytes (power of two)
+ * @retval	!=NULL			success (a pointer to the memory block)
+ * @retval	NULL			failure
+ *
+ * @note O(1): searches for a block with room for the alignment gap, and
+ *       splits the gap off in front as a free block.
+ */
+static void* allocate_aligned(struct Allocator* const self, const size_t size, const size_t alignment)
+{
+	if (alignment <= kALIGNMENT_UNIT) { return allocate(self, size); }
+
+	struct TlsfHeap* const heap = (struct TlsfHeap*)self;
+
+	const size_t gapMin = kBLOCK_OVERHEAD + kBLOCK_SIZE_MIN;
+	if ((size > heap->allocatableSizeMax) || (alignment > (heap->allocatableSizeMax - size))) { return NULL; }
+
+	const size_t adjusted = adjust_size(size);
+
+	struct Block* block = find_free_block(heap, (adjusted + alignment + gapMin));
+	if (!block) { return NULL; }
+	remove_free_block(heap, block);
+
+	const uintptr_t payload = (uintptr_t)block_payload(block);
+	uintptr_t aligned = (payload + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+	if ((aligned != payload) && ((aligned - payload) < gapMin)) {
+		aligned = (payload + gapMin + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+	}
+
+	if (aligned != payload) {
+		/* the gap becomes a free block (its previous block is never free) */
+		const size_t gap = (size_t)(aligned - payload);
+		struct Block* const alignedBlock = block_from_payload((void*)aligned);
+		alignedBlock->prevPhys = block;
+		alignedBlock->size = block_size(block) - gap;
+		block_next(alignedBlock)->prevPhys = alignedBlock;
+		block->size = gap - kBLOCK_OVERHEAD;
+		insert_free_block(heap, block);
+		block = alignedBlock;
+	}
+	trim_block(heap, block, adjusted);
+
+	heap->totalAllocatedSize += block_size(block);
+
+	return block_payload(block);
+}
+
+/**
+ * @brief	Deallocate memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	none
+ *
+ * @note O(1): merges with the free neighbors in memory.
+ */
+static void deallocate(struct Allocator* const self, void* const ptr)
+{
+	if (!ptr) { return; }
+
+	struct TlsfHeap* const heap = (struct TlsfHeap*)self;
+	struct Block* block = block_from_payload(ptr);
+	ASSERT_(!block_is_free(block));
+
+	heap->totalAllocatedSize -= block_size(block);
+
+	struct Block* const prev = block->prevPhys;
+	if (prev && block_is_free(prev)) {
+		remove_free_block(heap, prev);
+		prev->size = block_size(prev) + kBLOCK_OVERHEAD + block_size(block);
+		block = prev;
+		block_next(block)->prevPhys = block;
+	}
+
+	struct Block* const next = block_next(block);
+	if (block_is_free(next)) {
+		remove_free_block(heap, next);
+		block->size = block_size(block) + kBLOCK_OVERHEAD + block_size(next);
+		block_next(block)->prevPhys = block;
+	}
+
+	insert_free_block(heap, block);
+}
+
+/**
+ * @brief	Get the size of memory block
+ * @param	self			Allocator*
+ * @param	ptr				pointer to the memory block
+ * @return	the payload size of the block
+ */
+static size_t allocated_size(const struct Allocator* const self, const void* const ptr)
+{
+	(void)self;
+
+	return block_size(block_from_payload(ptr));
+}
@@ -0,0 +1,58 @@
+/**
+ * @file	tlsf_allocator.h
+ * @brief	TLSF (Two-Level Segregated Fit) allocator
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_KERNEL_MEMORY_TLSF_ALLOCATOR_H_INCLUDED_
+#define SDPSES_KERNEL_MEMORY_TLSF_ALLOCATOR_H_INCLUDED_
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct	TlsfAllocatorStatistics
+ * @brief	Fragmentation statistics of a TLSF heap
+ */
+struct TlsfAllocatorStatistics {
+	size_t totalFreeSize;
+	size_t freeBlockNum;
+	size_t largestFreeBlockSize;	/*!< approximate: a lower bound within one size class */
+	unsigned int fragmentation;		/*!< [%] (0: all free memory is one block, from largestFreeBlockSize) */
+};
+
+void TlsfAllocator_initialize(void);
+void TlsfAllocator_terminate(void);
+
+unsigned long TlsfAllocator_totalAllocationRequests(void);
+unsigned long TlsfAllocator_totalDeallocationRequests(void);
+
+size_t TlsfAllocator_totalAllocatedSize(void);
+size_t TlsfAllocator_allocatableSizeMax(void);
+
+size_t TlsfAllocator_totalFreeSize(void);
+size_t TlsfAllocator_freeBlockNum(void);
+size_t TlsfAllocator_largestFreeBlockSize(void);
+unsigned int TlsfAllocator_fragmentation(void);
+
+Allocator* TlsfAllocator_createHeap(void* memory, size_t size, const char* name);
+void TlsfAllocator_heapStatistics(const Allocator* heap, struct TlsfAllocatorStatistics* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDPSES_KERNEL_MEMORY_TLSF_ALLOCATOR_H_INCLUDED_ */
@@ -0,0 +1,11 @@
+/**
+ * @file	tlsf_allocator_cfg.h
+ * @brief	TLSF allocator configuration
+ */
+
+//#define TLSF_ALLOCATOR_MEMORY_POOL_BASE 0x00000000UL
+
+enum { kTLSF_ALLOCATOR_SIZE_MAX = (1024 * 64) };
+
+/*! @note log2 of the largest block: must be >= log2 of the largest heap (incl. TlsfAllocator_createHeap()). */
+enum { kTLSF_ALLOCATOR_FL_INDEX_MAX = 16 };
@@ -0,0 +1,49 @@
+/**
+ * @file	lib_barrier.h
+ * @brief	memory barrier
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_LIBUTL_LIB_BARRIER_H_INCLUDED_
+#define SDPSES_LIBUTL_LIB_BARRIER_H_INCLUDED_
+
+/*--- ALTERA(intel) Nios II / XILINX MicroBlaze ------------------------------*/
+#if defined(__NIOS2__) || defined(__MICROBLAZE__)
+/*! @note Single core: ordering against an ISR only needs the compiler barrier. */
+static inline void lib_barrier_acquire(void) {
+	__asm__ __volatile__ ("" ::: "memory");
+}
+static inline void lib_barrier_release(void) {
+	__asm__ __volatile__ ("" ::: "memory");
+}
+
+/*--- Other Processor --------------------------------------------------------*/
+#elif defined(__ATOMIC_ACQUIRE)
+static inline void lib_barrier_acquire(void) {
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+static inline void lib_barrier_release(void) {
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+#else
+static inline void lib_barrier_acquire(void) {
+	__sync_synchronize();
+}
+static inline void lib_barrier_release(void) {
+	__sync_synchronize();
+}
+
+#endif
+
+#endif /* SDPSES_LIBUTL_LIB_BARRIER_H_INCLUDED_ */
@@ -0,0 +1,47 @@
+/**
+ * @file	lib_critical_section.h
+ * @brief	critical section
+ * @author	Tsuguyoshi Higano
+ * @date	Oct 16, 2026
+ *
+ * @par Project
+ * Software Development Platform for Small-scale Embedded Systems (SDPSES)
+ *
+ * @copyright (c) Tsuguyoshi Higano, 2026
+ *
+ * @par License
+ * Released under the MIT license@n
+ * http://opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SDPSES_LIBUTL_LIB_CRITICAL_SECTION_H_INCLUDED_
+#define SDPSES_LIBUTL_LIB_CRITICAL_SECTION_H_INCLUDED_
+
+/*--- ALTERA(intel) Nios II / XILINX MicroBlaze ------------------------------*/
+#if defined(__NIOS2__) || defined(__MICROBLAZE__)
+#include "device_interrupt.h"
+typedef interrupt_context_t lib_critical_section_t;
+
+/*! @note Masks all interrupts. Nesting is allowed (e.g. called from an ISR). */
+static inline lib_critical_section_t lib_critical_section_enter(void) {
+	return device_interrupt_disable_all();
+}
+static inline void lib_critical_section_exit(const lib_critical_section_t context) {
+	device_interrupt_enable_all(context);
+}
+
+/*--- Other Processor --------------------------------------------------------*/
+#else
+typedef int lib_critical_section_t;
+
+/*! @note No interrupts to mask (e.g. host build). */
+static inline lib_critical_section_t lib_critical_section_enter(void) {
+	return 0;
+}
+static inline void lib_critical_section_exit(const lib_critical_section_t context) {
+	(void)context;
+}
+
+#endif
+
+#endif /* SDPSES_LIBUTL_LIB_CRITICAL_SECTION_H_INCLUDED_ */